@@ -177,9 +177,9 @@ protected:
 		if(effectiveAddress.ShowAddress && effectiveAddress.Address >= 0) {
 			if(_options.UseLabels) {
 				AddressInfo addr { effectiveAddress.Address, cpuMemoryType };
-				string label = _labelManager->GetLabel(addr);
+				string_view label = _labelManager->GetLabelView(addr);
 				if(!label.empty()) {
-					WriteStringValue(output, " [" + label + "]", rowPart);
+					WriteStringValue(output, " [" + string(label) + "]", rowPart);
 					return;
 				}
 			}
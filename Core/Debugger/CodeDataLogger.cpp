@@ -15,6 +15,7 @@ CodeDataLogger::CodeDataLogger(Debugger* debugger, MemoryType memType, uint32_t
 	_memSize = memSize;
 	_romCrc32 = romCrc32;
 	_cdlData = new uint8_t[memSize];
+	_changeStamps.resize((memSize >> Disassembler::ChangePageShift) + 1);
 	Reset();
 
 	debugger->GetCdlManager()->RegisterCdl(memType, this);
@@ -30,6 +31,16 @@ void CodeDataLogger::Reset()
 	memset(_cdlData, 0, _memSize);
 }
 
+void CodeDataLogger::MarkChanged(int32_t absoluteAddr)
+{
+	_changeStamps[absoluteAddr >> Disassembler::ChangePageShift] = Disassembler::GetChangeGeneration();
+}
+
+uint32_t CodeDataLogger::GetChangeStamp(uint32_t absoluteAddr)
+{
+	return _changeStamps[absoluteAddr >> Disassembler::ChangePageShift];
+}
+
 uint8_t* CodeDataLogger::GetRawData()
 {
 	return _cdlData;
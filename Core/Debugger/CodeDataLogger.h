@@ -11,6 +11,7 @@ protected:
 	constexpr static int HeaderSize = 9; //"CDLv2" + 4-byte CRC32 value
 
 	uint8_t* _cdlData = nullptr;
+	vector<uint32_t> _changeStamps;
 	CpuType _cpuType = CpuType::Snes;
 	MemoryType _memType = {};
 	uint32_t _memSize = 0;
@@ -19,6 +20,17 @@ protected:
 	virtual void InternalLoadCdlFile(uint8_t* cdlData, uint32_t cdlSize) {}
 	virtual void InternalSaveCdlFile(ofstream& cdlFile) {}
 
+	void MarkChanged(int32_t absoluteAddr);
+
+	__forceinline void SetFlags(int32_t absoluteAddr, uint8_t flags)
+	{
+		uint8_t& value = _cdlData[absoluteAddr];
+		if((value & flags) != flags) {
+			value |= flags;
+			MarkChanged(absoluteAddr);
+		}
+	}
+
 public:
 	CodeDataLogger(Debugger* debugger, MemoryType memType, uint32_t memSize, CpuType cpuType, uint32_t romCrc32);
 	virtual ~CodeDataLogger();
@@ -35,18 +47,18 @@ public:
 	template<uint8_t flags = 0>
 	void SetCode(int32_t absoluteAddr)
 	{
-		_cdlData[absoluteAddr] |= CdlFlags::Code | flags;
+		SetFlags(absoluteAddr, CdlFlags::Code | flags);
 	}
 
 	void SetCode(int32_t absoluteAddr, uint8_t flags)
 	{
-		_cdlData[absoluteAddr] |= CdlFlags::Code | flags;
+		SetFlags(absoluteAddr, CdlFlags::Code | flags);
 	}
 
 	template<uint8_t flags = 0>
 	void SetData(int32_t absoluteAddr)
 	{
-		_cdlData[absoluteAddr] |= CdlFlags::Data | flags;
+		SetFlags(absoluteAddr, CdlFlags::Data | flags);
 	}
 
 	virtual CdlStatistics GetStatistics();
@@ -59,6 +71,9 @@ public:
 	void SetCdlData(uint8_t *cdlData, uint32_t length);
 	void GetCdlData(uint32_t offset, uint32_t length, uint8_t *cdlData);
 	uint8_t GetFlags(uint32_t addr);
+
+	//Disassembler change generation of the last flag change in the page that contains this address
+	uint32_t GetChangeStamp(uint32_t absoluteAddr);
 	
 	uint32_t GetFunctions(uint32_t functions[], uint32_t maxSize);
 
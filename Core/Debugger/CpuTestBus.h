@@ -0,0 +1,33 @@
+#pragma once
+#include "pch.h"
+#include "Debugger/DebugTypes.h"
+#include "Shared/MemoryType.h"
+
+//Flat RAM bus used to run the dummy CPUs against single-step test vectors (see CpuTestRunner).
+//All reads/writes go to the RAM buffer (no registers/mirrors) and are logged.
+struct CpuTestBus
+{
+	vector<uint8_t> Ram;
+	uint32_t AddressMask = 0;
+	vector<MemoryOperationInfo> Operations;
+
+	CpuTestBus(uint32_t size)
+	{
+		Ram.resize(size);
+		AddressMask = size - 1;
+		Operations.reserve(100);
+	}
+
+	uint8_t Read(uint32_t addr, MemoryOperationType type)
+	{
+		uint8_t value = Ram[addr & AddressMask];
+		Operations.push_back({ addr & AddressMask, value, type, MemoryType::None });
+		return value;
+	}
+
+	void Write(uint32_t addr, uint8_t value, MemoryOperationType type)
+	{
+		Ram[addr & AddressMask] = value;
+		Operations.push_back({ addr & AddressMask, value, type, MemoryType::None });
+	}
+};
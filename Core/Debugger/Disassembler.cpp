@@ -6,6 +6,7 @@
 #include "Debugger/Debugger.h"
 #include "Debugger/LabelManager.h"
 #include "Debugger/MemoryDumper.h"
+#include "Debugger/MemoryAccessCounter.h"
 #include "Debugger/CodeDataLogger.h"
 #include "Debugger/DebugBreakHelper.h"
 #include "Debugger/DebugUtilities.h"
@@ -21,6 +22,9 @@
 #include "Utilities/HexUtilities.h"
 #include "Utilities/StringUtilities.h"
 
+//Shared by all instances, to ensure cached rows never match stamps from a previous debugger session
+std::atomic<uint32_t> Disassembler::_changeGeneration(1);
+
 Disassembler::Disassembler(IConsole* console, Debugger* debugger)
 {
 	_debugger = debugger;
@@ -37,7 +41,7 @@ Disassembler::Disassembler(IConsole* console, Debugger* debugger)
 void Disassembler::InitSource(MemoryType type)
 {
 	uint32_t size = _memoryDumper->GetMemorySize(type);
-	_sources[(int)type] = { vector<DisassemblyInfo>(size), size };
+	_sources[(int)type] = { vector<DisassemblyInfo>(size), vector<uint32_t>((size >> ChangePageShift) + 1), size };
 }
 
 DisassemblerSource& Disassembler::GetSource(MemoryType type)
@@ -60,6 +64,8 @@ uint32_t Disassembler::BuildCache(AddressInfo &addrInfo, uint8_t cpuFlags, CpuTy
 				//(can happen when resizing an instruction after X/M updates)
 				src.Cache[address + i] = DisassemblyInfo();
 			}
+			MarkChanged(src, address);
+			MarkChanged(src, std::min<int32_t>(address + disInfo.GetOpSize() - 1, (int32_t)src.Cache.size() - 1));
 			returnSize += disInfo.GetOpSize();
 		} else {
 			returnSize += disInfo.GetOpSize();
@@ -84,6 +90,9 @@ void Disassembler::ResetPrgCache()
 	InitSource(MemoryType::GbPrgRom);
 	InitSource(MemoryType::NesPrgRom);
 	InitSource(MemoryType::PcePrgRom);
+
+	auto lock = _bankCacheLock.AcquireSafe();
+	_bankCache.clear();
 }
 
 void Disassembler::InvalidateCache(AddressInfo addrInfo, CpuType type)
@@ -92,7 +101,13 @@ void Disassembler::InvalidateCache(AddressInfo addrInfo, CpuType type)
 		DisassemblerSource& src = GetSource(addrInfo.Type);
 		for(int i = 0; i < 4; i++) {
 			if(addrInfo.Address >= i) {
-				src.Cache[addrInfo.Address - i].Reset();
+				DisassemblyInfo& disInfo = src.Cache[addrInfo.Address - i];
+				if(disInfo.IsInitialized()) {
+					//Only mark the page as changed when an instruction was actually removed from the cache
+					//(most writes are to data and do not affect the disassembly)
+					disInfo.Reset();
+					MarkChanged(src, addrInfo.Address - i);
+				}
 			}
 		}
 	}
@@ -115,7 +130,6 @@ vector<DisassemblyResult> Disassembler::Disassemble(CpuType cpuType, uint16_t ba
 	bool inUnknownBlock = false;
 	bool inVerifiedBlock = false;
 	bool inUnmappedBlock = false;
-	LabelInfo labelInfo;
 	AddressInfo prevAddrInfo = {};
 	int byteCounter = 0;
 	
@@ -194,11 +208,11 @@ vector<DisassemblyResult> Disassembler::Disassemble(CpuType cpuType, uint16_t ba
 				results.push_back(DisassemblyResult(addrInfo, i, LineFlags::SubStart | LineFlags::BlockStart | LineFlags::VerifiedCode | LineFlags::Empty));
 			}
 
-			if(_labelManager->GetLabelAndComment(addrInfo, labelInfo)) {
-				bool hasMultipleComment = labelInfo.Comment.find_first_of('\n') != string::npos;
+			if(const LabelTableEntry* labelInfo = _labelManager->GetLabelEntry(addrInfo)) {
+				bool hasMultipleComment = labelInfo->Comment.find_first_of('\n') != string_view::npos;
 				if(hasMultipleComment) {
 					int16_t lineCount = 0;
-					for(char c : labelInfo.Comment) {
+					for(char c : labelInfo->Comment) {
 						if(c == '\n') {
 							results.push_back(DisassemblyResult(addrInfo, i, LineFlags::Comment, lineCount));
 							lineCount++;
@@ -207,11 +221,11 @@ vector<DisassemblyResult> Disassembler::Disassemble(CpuType cpuType, uint16_t ba
 					results.push_back(DisassemblyResult(addrInfo, i, LineFlags::Comment, lineCount));
 				}
 
-				if(labelInfo.Label.size()) {
+				if(labelInfo->Label.size()) {
 					results.push_back(DisassemblyResult(addrInfo, i, LineFlags::Label));
 				}
 
-				if(!hasMultipleComment && labelInfo.Comment.size()) {
+				if(!hasMultipleComment && labelInfo->Comment.size()) {
 					results.push_back(DisassemblyResult(addrInfo, i, LineFlags::Comment));
 				} else {
 					results.push_back(DisassemblyResult(addrInfo, i));
@@ -561,15 +575,152 @@ int32_t Disassembler::GetMatchingRow(vector<DisassemblyResult>& rows, uint32_t a
 	return std::max(0, i);
 }
 
+uint8_t Disassembler::GetConfigFlags()
+{
+	DebugConfig& cfg = _settings->GetDebugConfig();
+	return (
+		(cfg.DisassembleUnidentifiedData ? 0x01 : 0) |
+		(cfg.DisassembleVerifiedData ? 0x02 : 0) |
+		(cfg.ShowUnidentifiedData ? 0x04 : 0) |
+		(cfg.ShowVerifiedData ? 0x08 : 0) |
+		(cfg.ShowJumpLabels ? 0x10 : 0) |
+		(cfg.UseLowerCaseDisassembly ? 0x20 : 0) |
+		(cfg.SnesUseAltSpcOpNames ? 0x40 : 0)
+	);
+}
+
+void Disassembler::GetMappings(CpuType cpuType, uint16_t bank, vector<DisassemblyMappingRange>& mappings)
+{
+	AddressInfo relAddress = {};
+	relAddress.Type = DebugUtilities::GetCpuMemoryType(cpuType);
+
+	int32_t bankStart = bank << 16;
+	int32_t bankEnd = std::min<int32_t>((bank + 1) << 16, (int32_t)_memoryDumper->GetMemorySize(relAddress.Type));
+
+	//Map every byte of the bank, to record all mapping changes inside each page (e.g the GB's HRAM at $FF80-$FFFE
+	//between registers, or the SPC's IPL ROM) - a range is also started at each page boundary, so that bank
+	//switching is detected by only checking the start and end of each range
+	mappings.clear();
+	for(int32_t addr = bankStart; addr < bankEnd; addr++) {
+		relAddress.Address = addr;
+		AddressInfo absAddress = _console->GetAbsoluteAddress(relAddress);
+
+		if(!mappings.empty() && (addr & (ChangePageSize - 1)) != 0) {
+			DisassemblyMappingRange& range = mappings.back();
+			bool isContiguous = absAddress.Type == range.AbsStart.Type && (
+				absAddress.Address < 0 ? range.AbsStart.Address < 0 : (range.AbsStart.Address >= 0 && absAddress.Address == range.AbsStart.Address + (addr - range.Start))
+			);
+
+			if(isContiguous) {
+				range.End = addr;
+				continue;
+			}
+		}
+
+		mappings.push_back({ addr, addr, absAddress });
+	}
+}
+
+bool Disassembler::IsBankCacheValid(DisassemblyBankCache& cache, CpuType cpuType, uint16_t bank)
+{
+	uint8_t configFlags = GetConfigFlags();
+	if(cache.ConfigFlags != configFlags || cache.LabelChangeCount != _labelManager->GetChangeCount()) {
+		return false;
+	}
+
+	//Bytes that are not in the disassembly cache or CDL are disassembled from memory when these options are enabled
+	bool checkMemory = (configFlags & 0x03) != 0;
+	MemoryAccessCounter* accessCounter = _debugger->GetMemoryAccessCounter();
+	CdlManager* cdlManager = _debugger->GetCdlManager();
+
+	AddressInfo relAddress = {};
+	relAddress.Type = DebugUtilities::GetCpuMemoryType(cpuType);
+
+	for(DisassemblyMappingRange& range : cache.Mappings) {
+		AddressInfo absStart = range.AbsStart;
+		AddressInfo absEnd = absStart;
+		if(absStart.Address >= 0) {
+			absEnd.Address += range.End - range.Start;
+		}
+
+		//Check if mappings changed (e.g bank switching)
+		relAddress.Address = range.Start;
+		AddressInfo addrInfo = _console->GetAbsoluteAddress(relAddress);
+		if(addrInfo.Address != absStart.Address || addrInfo.Type != absStart.Type) {
+			return false;
+		}
+
+		relAddress.Address = range.End;
+		addrInfo = _console->GetAbsoluteAddress(relAddress);
+		if(addrInfo.Address != absEnd.Address || addrInfo.Type != absEnd.Type) {
+			return false;
+		}
+
+		if(absStart.Address < 0 || absStart.Type == MemoryType::SnesRegister) {
+			continue;
+		}
+
+		DisassemblerSource& src = GetSource(absStart.Type);
+		CodeDataLogger* cdl = cdlManager->GetCodeDataLogger(absStart.Type);
+		for(uint32_t page = absStart.Address >> ChangePageShift, lastPage = absEnd.Address >> ChangePageShift; page <= lastPage; page++) {
+			uint32_t pageAddr = page << ChangePageShift;
+			if(src.ChangeStamps[page] >= cache.Generation) {
+				return false;
+			}
+
+			if(cdl && cdl->GetChangeStamp(pageAddr) >= cache.Generation) {
+				return false;
+			}
+
+			if(checkMemory && accessCounter->IsPageChanged(absStart.Type, pageAddr, cache.MemoryGeneration)) {
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+shared_ptr<DisassemblyBankCache> Disassembler::GetBankCache(CpuType cpuType, uint16_t bank)
+{
+	uint32_t key = ((uint32_t)cpuType << 16) | bank;
+	shared_ptr<DisassemblyBankCache> cache;
+	{
+		auto lock = _bankCacheLock.AcquireSafe();
+		auto result = _bankCache.find(key);
+		if(result != _bankCache.end()) {
+			cache = result->second;
+		}
+	}
+
+	if(cache && IsBankCacheValid(*cache, cpuType, bank)) {
+		return cache;
+	}
+
+	//Start a new generation before disassembling - any change made while the bank is being disassembled
+	//gets stamped with a newer generation and will invalidate these rows on the next call
+	cache.reset(new DisassemblyBankCache());
+	cache->Generation = ++_changeGeneration;
+	cache->MemoryGeneration = _debugger->GetMemoryAccessCounter()->NextChangeGeneration();
+	cache->LabelChangeCount = _labelManager->GetChangeCount();
+	cache->ConfigFlags = GetConfigFlags();
+	GetMappings(cpuType, bank, cache->Mappings);
+	cache->Rows = Disassemble(cpuType, bank);
+
+	auto lock = _bankCacheLock.AcquireSafe();
+	_bankCache[key] = cache;
+	return cache;
+}
+
 uint32_t Disassembler::GetDisassemblyOutput(CpuType type, uint32_t address, CodeLineData output[], uint32_t rowCount)
 {
 	uint16_t bank = address >> 16;
-	Timer timer;
-	vector<DisassemblyResult> rows = Disassemble(type, bank);
+	shared_ptr<DisassemblyBankCache> cache = GetBankCache(type, bank);
+	vector<DisassemblyResult>* rows = &cache->Rows;
 
-	int32_t i = GetMatchingRow(rows, address, true);
+	int32_t i = GetMatchingRow(*rows, address, true);
 
-	if(i >= (int32_t)rows.size()) {
+	if(i >= (int32_t)rows->size()) {
 		return 0;
 	}
 
@@ -578,11 +729,12 @@ uint32_t Disassembler::GetDisassemblyOutput(CpuType type, uint32_t address, Code
 
 	int32_t row;
 	for(row = 0; row < (int32_t)rowCount; row++){
-		if(row + i >= rows.size()) {
+		if(row + i >= (int32_t)rows->size()) {
 			if(bank < maxBank) {
 				bank++;
-				rows = Disassemble(type, bank);
-				if(rows.size() == 0) {
+				cache = GetBankCache(type, bank);
+				rows = &cache->Rows;
+				if(rows->size() == 0) {
 					break;
 				}
 				i = -row;
@@ -591,7 +743,7 @@ uint32_t Disassembler::GetDisassemblyOutput(CpuType type, uint32_t address, Code
 			}
 		}
 
-		GetLineData(rows[row + i], type, memType, output[row]);
+		GetLineData((*rows)[row + i], type, memType, output[row]);
 	}
 
 	return row;
@@ -607,20 +759,21 @@ uint16_t Disassembler::GetMaxBank(CpuType cpuType)
 int32_t Disassembler::GetDisassemblyRowAddress(CpuType cpuType, uint32_t address, int32_t rowOffset)
 {
 	uint16_t bank = address >> 16;
-	vector<DisassemblyResult> rows = Disassemble(cpuType, bank);
-	int32_t len = (int32_t)rows.size();
+	shared_ptr<DisassemblyBankCache> cache = GetBankCache(cpuType, bank);
+	vector<DisassemblyResult>* rows = &cache->Rows;
+	int32_t len = (int32_t)rows->size();
 	if(len == 0) {
 		return address;
 	}
 
 	uint16_t maxBank = GetMaxBank(cpuType);
-	int32_t i = GetMatchingRow(rows, address, false);
+	int32_t i = GetMatchingRow(*rows, address, false);
 
 	if(rowOffset > 0) {
 		while(len > 0) {
 			for(; i < len; i++) {
-				if(rowOffset <= 0 && rows[i].CpuAddress >= 0 && rows[i].CpuAddress != (int32_t)address) {
-					return rows[i].CpuAddress;
+				if(rowOffset <= 0 && (*rows)[i].CpuAddress >= 0 && (*rows)[i].CpuAddress != (int32_t)address) {
+					return (*rows)[i].CpuAddress;
 				}
 				rowOffset--;
 			}
@@ -628,19 +781,20 @@ int32_t Disassembler::GetDisassemblyRowAddress(CpuType cpuType, uint32_t address
 			//End of bank, didn't find an appropriate row to jump to, try the next bank
 			if(bank == maxBank) {
 				//Reached bottom of last bank, return the bottom row
-				return rows[len - 1].CpuAddress >= 0 ? rows[len - 1].CpuAddress : address;
+				return (*rows)[len - 1].CpuAddress >= 0 ? (*rows)[len - 1].CpuAddress : address;
 			}
 
 			bank++;
-			rows = Disassemble(cpuType, bank);
-			len = (int32_t)rows.size();
+			cache = GetBankCache(cpuType, bank);
+			rows = &cache->Rows;
+			len = (int32_t)rows->size();
 			i = 0;
 		}
 	} else if(rowOffset < 0) {
 		while(len > 0) {
 			for(; i >= 0; i--) {
-				if(rowOffset >= 0 && rows[i].CpuAddress >= 0 && rows[i].CpuAddress != (int32_t)address) {
-					return rows[i].CpuAddress;
+				if(rowOffset >= 0 && (*rows)[i].CpuAddress >= 0 && (*rows)[i].CpuAddress != (int32_t)address) {
+					return (*rows)[i].CpuAddress;
 				}
 				rowOffset++;
 			}
@@ -648,12 +802,13 @@ int32_t Disassembler::GetDisassemblyRowAddress(CpuType cpuType, uint32_t address
 			//Start of bank, didn't find an appropriate row to jump to, try the previous bank
 			if(bank == 0) {
 				//Reached top of first bank, return the top row
-				return rows[0].CpuAddress >= 0 ? rows[0].CpuAddress : address;
+				return (*rows)[0].CpuAddress >= 0 ? (*rows)[0].CpuAddress : address;
 			}
 
 			bank--;
-			rows = Disassemble(cpuType, bank);
-			len = (int32_t)rows.size();
+			cache = GetBankCache(cpuType, bank);
+			rows = &cache->Rows;
+			len = (int32_t)rows->size();
 			i = len - 1;
 		}
 	}
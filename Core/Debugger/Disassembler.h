@@ -3,6 +3,8 @@
 #include "Debugger/DisassemblyInfo.h"
 #include "Debugger/DebugTypes.h"
 #include "Debugger/DebugUtilities.h"
+#include "Utilities/SimpleLock.h"
+#include <mutex>
 
 class IConsole;
 class Debugger;
@@ -17,9 +19,44 @@ enum class CpuType : uint8_t;
 struct DisassemblerSource
 {
 	vector<DisassemblyInfo> Cache;
+	vector<uint32_t> ChangeStamps;
 	uint32_t Size = 0;
 };
 
+struct DisassemblySearchLine
+{
+	//Offset of the row's text in SearchText (followed by its comment)
+	uint32_t Offset;
+
+	//Row contains text that can change without the bank being invalidated (effective address, memory values)
+	bool Dynamic;
+};
+
+//Part of a bank (relative addresses, never crosses a 256-byte page) that maps to a contiguous block of memory, or to nothing
+struct DisassemblyMappingRange
+{
+	int32_t Start;
+	int32_t End;
+	AddressInfo AbsStart;
+};
+
+//Rows generated by Disassemble() for a bank, along with everything needed to check if they are still up to date
+//Never modified once built (an invalidated bank is replaced by a new instance), except for the search index
+struct DisassemblyBankCache
+{
+	vector<DisassemblyResult> Rows;
+	vector<DisassemblyMappingRange> Mappings;
+	uint32_t Generation = 0;
+	uint32_t MemoryGeneration = 0;
+	uint32_t LabelChangeCount = 0;
+	uint8_t ConfigFlags = 0;
+
+	//Formatted text of all rows, built by DisassemblySearch the first time the bank is searched
+	std::once_flag SearchIndexFlag;
+	string SearchText;
+	vector<DisassemblySearchLine> SearchLines;
+};
+
 class Disassembler
 {
 private:
@@ -32,16 +69,37 @@ private:
 	MemoryDumper *_memoryDumper;
 
 	DisassemblerSource _sources[DebugUtilities::GetMemoryTypeCount()] = {};
+
+	static std::atomic<uint32_t> _changeGeneration;
+
+	SimpleLock _bankCacheLock;
+	unordered_map<uint32_t, shared_ptr<DisassemblyBankCache>> _bankCache;
 	
 	void InitSource(MemoryType type);
 	DisassemblerSource& GetSource(MemoryType type);
 
+	__forceinline void MarkChanged(DisassemblerSource& src, int32_t address)
+	{
+		src.ChangeStamps[address >> ChangePageShift] = _changeGeneration.load(std::memory_order_relaxed);
+	}
+
+	uint8_t GetConfigFlags();
+	void GetMappings(CpuType cpuType, uint16_t bank, vector<DisassemblyMappingRange>& mappings);
+	bool IsBankCacheValid(DisassemblyBankCache& cache, CpuType cpuType, uint16_t bank);
+	shared_ptr<DisassemblyBankCache> GetBankCache(CpuType cpuType, uint16_t bank);
+
 	void GetLineData(DisassemblyResult& result, CpuType type, MemoryType memType, CodeLineData& data);
 	int32_t GetMatchingRow(vector<DisassemblyResult>& rows, uint32_t address, bool returnFirstRow);
 	vector<DisassemblyResult> Disassemble(CpuType cpuType, uint16_t bank);
 	uint16_t GetMaxBank(CpuType cpuType);
 	
 public:
+	//Changes to the disassembly cache and CDL data are tracked for each 256-byte page of each memory type
+	static constexpr uint32_t ChangePageShift = 8;
+	static constexpr uint32_t ChangePageSize = 1 << ChangePageShift;
+
+	static uint32_t GetChangeGeneration() { return _changeGeneration.load(std::memory_order_relaxed); }
+
 	Disassembler(IConsole* console, Debugger* debugger);
 
 	uint32_t BuildCache(AddressInfo &addrInfo, uint8_t cpuFlags, CpuType type);
@@ -24,120 +24,190 @@ uint32_t DisassemblySearch::FindOccurrences(CpuType cpuType, const char* searchS
 uint32_t DisassemblySearch::SearchDisassembly(CpuType cpuType, const char* searchString, int32_t startAddress, DisassemblySearchOptions options, CodeLineData searchResults[], uint32_t maxResultCount)
 {
 	MemoryType memType = DebugUtilities::GetCpuMemoryType(cpuType);
-	uint16_t bank = startAddress >> 16;
+	uint16_t startBank = startAddress >> 16;
 	uint16_t maxBank = _disassembler->GetMaxBank(cpuType);
 
-	vector<DisassemblyResult> rows = _disassembler->Disassemble(cpuType, bank);
-	if(rows.empty()) {
-		return -1;
+	shared_ptr<DisassemblyBankCache> startCache = _disassembler->GetBankCache(cpuType, startBank);
+	vector<DisassemblyResult>& rows = startCache->Rows;
+	if(rows.empty() || maxResultCount == 0) {
+		return 0;
 	}
-	int step = options.SearchBackwards ? -1 : 1;
 
 	string searchStr = searchString;
 
+	int32_t rowCount = (int32_t)rows.size();
 	int32_t startRow = _disassembler->GetMatchingRow(rows, startAddress, options.SearchBackwards);
 	if(options.SearchBackwards) {
 		startRow--;
 	} else if(options.SkipFirstLine) {
 		startRow++;
 	}
+	startRow = std::clamp(startRow, -1, rowCount);
+
+	//Build the list of row ranges to search, in the order the results must be returned in:
+	//the rest of the start bank, all other banks (wrapping around), then the start of the start bank
+	vector<DisassemblySearchSegment> segments;
+	segments.push_back({ startBank, startRow, options.SearchBackwards ? -1 : rowCount, startCache });
 
-	if(startRow >= 0 && startRow < rows.size()) {
-		startAddress = rows[startRow].CpuAddress;
+	//A forward search from the start of memory (e.g FindOccurrences) stops at the last bank
+	bool wrapAround = options.SearchBackwards || startAddress != 0;
+	if(options.SearchBackwards) {
+		for(int bank = (int)startBank - 1; bank >= 0; bank--) {
+			segments.push_back({ (uint16_t)bank });
+		}
+		for(int bank = maxBank; bank > startBank; bank--) {
+			segments.push_back({ (uint16_t)bank });
+		}
+	} else {
+		for(int bank = (int)startBank + 1; bank <= maxBank; bank++) {
+			segments.push_back({ (uint16_t)bank });
+		}
+		if(wrapAround) {
+			for(int bank = 0; bank < startBank; bank++) {
+				segments.push_back({ (uint16_t)bank });
+			}
+		}
 	}
 
-	uint32_t resultCount = 0;
+	if(wrapAround) {
+		segments.push_back({ startBank, options.SearchBackwards ? rowCount - 1 : 0, startRow, startCache });
+	}
 
-	int32_t prevAddress = -1;
+	std::call_once(_threadPoolFlag, [this]() { _threadPool.reset(new ThreadPool()); });
 
+	//Search the segments in batches of one segment per thread, and stop as soon as enough results
+	//were found in the segments that come first in the search order
+	uint32_t batchSize = _threadPool->GetThreadCount() + 1;
+	uint32_t resultCount = 0;
 	CodeLineData lineData = {};
-	int rowCounter = 0;
-
-	string txt;
-
-	do {
-		for(int i = startRow; i >= 0 && i < rows.size(); i += step) {
-			if(rows[i].CpuAddress < 0) {
-				continue;
+	for(size_t batchStart = 0; batchStart < segments.size(); batchStart += batchSize) {
+		uint32_t count = (uint32_t)std::min<size_t>(batchSize, segments.size() - batchStart);
+		_threadPool->ParallelFor(count, [&](uint32_t start, uint32_t end) {
+			for(uint32_t i = start; i < end; i++) {
+				SearchSegment(segments[batchStart + i], cpuType, memType, searchStr, options, maxResultCount);
 			}
+		});
 
-			if(
-				(!options.SearchBackwards && prevAddress < startAddress && rows[i].CpuAddress >= startAddress) ||
-				(options.SearchBackwards && prevAddress > startAddress && rows[i].CpuAddress <= startAddress) ||
-				rowCounter > 500000
-			) {
-				if(rowCounter > 0) {
-					//Checked entire memory space without finding a match (or checked over 500k rows), give up
+		for(uint32_t i = 0; i < count; i++) {
+			DisassemblySearchSegment& segment = segments[batchStart + i];
+			for(int32_t row : segment.MatchingRows) {
+				_disassembler->GetLineData(segment.Cache->Rows[row], cpuType, memType, lineData);
+				searchResults[resultCount] = lineData;
+				if(maxResultCount == ++resultCount) {
 					return resultCount;
 				}
 			}
+			segment.Cache.reset();
+		}
+	}
 
-			rowCounter++;
+	return resultCount;
+}
 
-			prevAddress = rows[i].CpuAddress;
+void DisassemblySearch::SearchSegment(DisassemblySearchSegment& segment, CpuType cpuType, MemoryType memType, string& needle, DisassemblySearchOptions& options, uint32_t maxResultCount)
+{
+	if(!segment.Cache) {
+		segment.Cache = _disassembler->GetBankCache(cpuType, segment.Bank);
+		int32_t rowCount = (int32_t)segment.Cache->Rows.size();
+		segment.StartRow = options.SearchBackwards ? rowCount - 1 : 0;
+		segment.EndRow = options.SearchBackwards ? -1 : rowCount;
+	}
 
-			_disassembler->GetLineData(rows[i], cpuType, memType, lineData);
+	if(segment.StartRow == segment.EndRow) {
+		return;
+	}
 
-			if(TextContains(searchStr, lineData.Text, 1000, options)) {
-				searchResults[resultCount] = lineData;
-				if(maxResultCount == ++resultCount) {
-					return resultCount;
-				}
-			}
+	DisassemblyBankCache& cache = *segment.Cache;
+	BuildSearchIndex(cache, cpuType, memType);
 
-			if(TextContains(searchStr, lineData.Comment, 1000, options)) {
-				searchResults[resultCount] = lineData;
-				if(maxResultCount == ++resultCount) {
-					return resultCount;
-				}
-			}
+	int step = options.SearchBackwards ? -1 : 1;
+	bool matchValue = maxResultCount == 1;
+	CodeLineData lineData = {};
+	for(int32_t i = segment.StartRow; i != segment.EndRow; i += step) {
+		DisassemblyResult& row = cache.Rows[i];
+		if(row.CpuAddress < 0) {
+			continue;
+		}
 
-			if(lineData.EffectiveAddress.Address >= 0) {
-				txt = _labelManager->GetLabel({ lineData.EffectiveAddress.Address, memType });
-				if(txt.empty()) {
-					txt = "[$" + DebugUtilities::AddressToHex(lineData.LineCpuType, lineData.EffectiveAddress.Address) + "]";
-				} else {
-					txt = "[" + txt + "]";
-				}
+		bool match;
+		DisassemblySearchLine& line = cache.SearchLines[i];
+		if(line.Dynamic) {
+			_disassembler->GetLineData(row, cpuType, memType, lineData);
+			match = IsMatch(lineData, memType, needle, options, matchValue);
+		} else {
+			const char* text = cache.SearchText.c_str() + line.Offset;
+			const char* comment = text + strlen(text) + 1;
+			match = TextContains(needle, text, 1000, options) || TextContains(needle, comment, 1000, options);
+		}
 
-				if(TextContains(searchStr, txt.c_str(), (int)txt.size(), options)) {
-					searchResults[resultCount] = lineData;
-					if(maxResultCount == ++resultCount) {
-						return resultCount;
-					}
-				}
+		if(match) {
+			segment.MatchingRows.push_back(i);
+			if(segment.MatchingRows.size() == maxResultCount) {
+				return;
 			}
+		}
+	}
+}
+
+void DisassemblySearch::BuildSearchIndex(DisassemblyBankCache& cache, CpuType cpuType, MemoryType memType)
+{
+	//The index is built once per bank cache instance - the instance is replaced whenever the bank's code, labels or settings change
+	std::call_once(cache.SearchIndexFlag, [&]() {
+		CodeLineData lineData = {};
+		cache.SearchLines.reserve(cache.Rows.size());
+		for(DisassemblyResult& row : cache.Rows) {
+			lineData.Text[0] = 0;
+			lineData.Comment[0] = 0;
+			_disassembler->GetLineData(row, cpuType, memType, lineData);
 
-			if(maxResultCount == 1 && lineData.EffectiveAddress.ValueSize > 0) {
-				txt = "$" + (lineData.EffectiveAddress.ValueSize == 2 ? HexUtilities::ToHex((uint16_t)lineData.Value) : HexUtilities::ToHex((uint8_t)lineData.Value));
-				if(TextContains(searchStr, txt.c_str(), (int)txt.size(), options)) {
-					searchResults[resultCount] = lineData;
-					if(maxResultCount == ++resultCount) {
-						return resultCount;
-					}
+			//Rows whose text depends on the current state of memory or of the CPU are matched live
+			bool dynamic = lineData.EffectiveAddress.Address >= 0 || lineData.EffectiveAddress.ValueSize > 0;
+			bool isBlockStartEnd = (row.Flags & (LineFlags::BlockStart | LineFlags::BlockEnd | LineFlags::Empty)) != 0;
+			if(!dynamic && !isBlockStartEnd && row.Address.Address >= 0) {
+				if(row.Flags & LineFlags::ShowAsData) {
+					dynamic = true;
+				} else if(!(row.Flags & (LineFlags::Comment | LineFlags::Label))) {
+					dynamic = !DebugUtilities::IsRom(row.Address.Type) || !_disassembler->GetSource(row.Address.Type).Cache[row.Address.Address].IsInitialized();
 				}
 			}
+
+			cache.SearchLines.push_back({ (uint32_t)cache.SearchText.size(), dynamic });
+			cache.SearchText.append(lineData.Text);
+			cache.SearchText.push_back(0);
+			cache.SearchText.append(lineData.Comment);
+			cache.SearchText.push_back(0);
 		}
+	});
+}
 
-		//No match found, go to next/previous bank
-		int nextBank = (int)bank + step;
-		if(nextBank < 0) {
-			nextBank = maxBank;
-		} else if(nextBank > maxBank) {
-			if(startAddress == 0) {
-				return resultCount;
-			}
-			nextBank = 0;
+bool DisassemblySearch::IsMatch(CodeLineData& lineData, MemoryType memType, string& needle, DisassemblySearchOptions& options, bool matchValue)
+{
+	if(TextContains(needle, lineData.Text, 1000, options) || TextContains(needle, lineData.Comment, 1000, options)) {
+		return true;
+	}
+
+	string txt;
+	if(lineData.EffectiveAddress.Address >= 0) {
+		txt = _labelManager->GetLabel({ lineData.EffectiveAddress.Address, memType });
+		if(txt.empty()) {
+			txt = "[$" + DebugUtilities::AddressToHex(lineData.LineCpuType, lineData.EffectiveAddress.Address) + "]";
+		} else {
+			txt = "[" + txt + "]";
 		}
-		bank = (uint16_t)nextBank;
-		rows = _disassembler->Disassemble(cpuType, bank);
-		if(rows.empty()) {
-			return resultCount;
+
+		if(TextContains(needle, txt.c_str(), (int)txt.size(), options)) {
+			return true;
 		}
-		startRow = options.SearchBackwards ? (int32_t)rows.size() - 1 : 0;
-	} while(true);
+	}
 
-	return resultCount;
+	if(matchValue && lineData.EffectiveAddress.ValueSize > 0) {
+		txt = "$" + (lineData.EffectiveAddress.ValueSize == 2 ? HexUtilities::ToHex((uint16_t)lineData.Value) : HexUtilities::ToHex((uint8_t)lineData.Value));
+		if(TextContains(needle, txt.c_str(), (int)txt.size(), options)) {
+			return true;
+		}
+	}
+
+	return false;
 }
 
 bool DisassemblySearch::TextContains(string& needle, const char* hay, int size, DisassemblySearchOptions& options)
@@ -3,9 +3,12 @@
 #include "Debugger/DisassemblyInfo.h"
 #include "Debugger/DebugTypes.h"
 #include "Debugger/DebugUtilities.h"
+#include "Utilities/ThreadPool.h"
+#include <mutex>
 
 class Disassembler;
 class LabelManager;
+struct DisassemblyBankCache;
 enum class CpuType : uint8_t;
 
 struct DisassemblySearchOptions
@@ -16,14 +19,31 @@ struct DisassemblySearchOptions
 	bool SkipFirstLine;
 };
 
+//Range of rows of a single bank, searched in order (in the search direction)
+struct DisassemblySearchSegment
+{
+	uint16_t Bank;
+	int32_t StartRow;
+	int32_t EndRow;
+	shared_ptr<DisassemblyBankCache> Cache;
+	vector<int32_t> MatchingRows;
+};
+
 class DisassemblySearch
 {
 private:
 	Disassembler* _disassembler;
 	LabelManager* _labelManager;
 
+	std::once_flag _threadPoolFlag;
+	unique_ptr<ThreadPool> _threadPool;
+
 	uint32_t SearchDisassembly(CpuType cpuType, const char* searchString, int32_t startAddress, DisassemblySearchOptions options, CodeLineData searchResults[], uint32_t maxResultCount);
 
+	void BuildSearchIndex(DisassemblyBankCache& cache, CpuType cpuType, MemoryType memType);
+	void SearchSegment(DisassemblySearchSegment& segment, CpuType cpuType, MemoryType memType, string& needle, DisassemblySearchOptions& options, uint32_t maxResultCount);
+	bool IsMatch(CodeLineData& lineData, MemoryType memType, string& needle, DisassemblySearchOptions& options, bool matchValue);
+
 	template<bool matchCase> bool TextContains(string& needle, const char* hay, int size, DisassemblySearchOptions& options);
 	bool TextContains(string& needle, const char* hay, int size, DisassemblySearchOptions& options);
 	bool IsWordSeparator(char c);
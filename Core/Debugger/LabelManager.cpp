@@ -14,12 +14,35 @@ void LabelManager::ClearLabels()
 	DebugBreakHelper helper(_debugger);
 	_codeLabels.clear();
 	_codeLabelReverseLookup.clear();
+	_tablesDirty = true;
+
+	if(_updateDepth == 0) {
+		RebuildTables();
+	}
+}
+
+void LabelManager::BeginUpdate()
+{
+	_updateDepth++;
+}
+
+void LabelManager::EndUpdate()
+{
+	DebugBreakHelper helper(_debugger);
+	if(_updateDepth > 0) {
+		_updateDepth--;
+	}
+
+	if(_updateDepth == 0 && _tablesDirty) {
+		RebuildTables();
+	}
 }
 
 void LabelManager::SetLabel(uint32_t address, MemoryType memType, string label, string comment)
 {
 	DebugBreakHelper helper(_debugger);
 	uint64_t key = GetLabelKey(address, memType);
+	_tablesDirty = true;
 
 	auto existingLabel = _codeLabels.find(key);
 	if(existingLabel != _codeLabels.end()) {
@@ -40,6 +63,10 @@ void LabelManager::SetLabel(uint32_t address, MemoryType memType, string label,
 		_codeLabels.emplace(key, labelInfo);
 		_codeLabelReverseLookup.emplace(label, key);
 	}
+
+	if(_updateDepth == 0) {
+		RebuildTables();
+	}
 }
 
 int64_t LabelManager::GetLabelKey(uint32_t absoluteAddr, MemoryType memType)
@@ -52,69 +79,109 @@ MemoryType LabelManager::GetKeyMemoryType(uint64_t key)
 	return (MemoryType)(key >> 32);
 }
 
-string LabelManager::GetLabel(AddressInfo address, bool checkRegisterLabels)
+void LabelManager::RebuildTables()
 {
-	string label;
-	if(DebugUtilities::IsRelativeMemory(address.Type)) {
-		if(checkRegisterLabels && InternalGetLabel(address, label)) {
-			//Labels for registers
-			return label;
-		}
-		address = _debugger->GetAbsoluteAddress(address);
+	//Must be called while the emulation is paused (DebugBreakHelper) - this frees the strings that the lookup functions return views of
+	for(LabelTable& table : _labelTables) {
+		table.Entries.clear();
+		table.PageDirectory.clear();
+		table.Pages.clear();
 	}
+	_stringPool.clear();
 
-	if(address.Address >= 0) {
-		InternalGetLabel(address, label);
+	auto intern = [this](const string& str) -> string_view {
+		return str.empty() ? string_view() : string_view(*_stringPool.insert(str).first);
+	};
+
+	for(auto& [key, labelInfo] : _codeLabels) {
+		MemoryType memType = GetKeyMemoryType(key);
+		if((int)memType < DebugUtilities::GetMemoryTypeCount()) {
+			_labelTables[(int)memType].Entries.push_back({ (uint32_t)key, intern(labelInfo.Label), intern(labelInfo.Comment) });
+		}
 	}
 
-	return label;
-}
+	for(LabelTable& table : _labelTables) {
+		if(table.Entries.empty()) {
+			continue;
+		}
 
-bool LabelManager::InternalGetLabel(AddressInfo address, string &label)
-{
-	int64_t key = GetLabelKey(address.Address, address.Type);
-	if(key >= 0) {
-		auto result = _codeLabels.find(key);
-		if(result != _codeLabels.end()) {
-			label = result->second.Label;
-			return true;
+		std::sort(table.Entries.begin(), table.Entries.end(), [](const LabelTableEntry& a, const LabelTableEntry& b) { return a.Address < b.Address; });
+
+		//Only pages that contain at least one label are allocated
+		table.PageDirectory.resize((table.Entries.back().Address >> LabelTable::PageShift) + 1);
+		for(uint32_t i = 0; i < (uint32_t)table.Entries.size(); i++) {
+			uint32_t addr = table.Entries[i].Address;
+			uint32_t& pageIndex = table.PageDirectory[addr >> LabelTable::PageShift];
+			if(pageIndex == 0) {
+				table.Pages.resize(table.Pages.size() + LabelTable::PageSize);
+				pageIndex = (uint32_t)(table.Pages.size() / LabelTable::PageSize);
+			}
+			table.Pages[(pageIndex - 1) * LabelTable::PageSize + (addr & (LabelTable::PageSize - 1))] = i + 1;
 		}
 	}
-	return false;
+
+	_tablesDirty = false;
+
+	//Only incremented once the tables are up to date, otherwise a tool could cache the results of a
+	//lookup done during a BeginUpdate/EndUpdate batch and never refresh them
+	_changeCount++;
 }
 
-string LabelManager::GetComment(AddressInfo absAddress)
+const LabelTableEntry* LabelManager::FindEntry(AddressInfo address)
 {
-	uint64_t key = GetLabelKey(absAddress.Address, absAddress.Type);
+	if(address.Address < 0 || (int)address.Type >= DebugUtilities::GetMemoryTypeCount()) {
+		return nullptr;
+	}
 
-	if(key >= 0) {
-		auto result = _codeLabels.find(key);
-		if(result != _codeLabels.end()) {
-			return result->second.Comment;
-		}
+	LabelTable& table = _labelTables[(int)address.Type];
+	uint32_t addr = (uint32_t)address.Address;
+	uint32_t page = addr >> LabelTable::PageShift;
+	if(page >= table.PageDirectory.size() || table.PageDirectory[page] == 0) {
+		return nullptr;
 	}
 
-	return "";
+	uint32_t entryIndex = table.Pages[(table.PageDirectory[page] - 1) * LabelTable::PageSize + (addr & (LabelTable::PageSize - 1))];
+	return entryIndex ? &table.Entries[entryIndex - 1] : nullptr;
 }
 
-bool LabelManager::GetLabelAndComment(AddressInfo address, LabelInfo &labelInfo)
+const LabelTableEntry* LabelManager::GetLabelEntry(AddressInfo address)
 {
 	if(DebugUtilities::IsRelativeMemory(address.Type)) {
 		address = _debugger->GetAbsoluteAddress(address);
 	}
+	return FindEntry(address);
+}
 
-	if(address.Address >= 0) {
-		int64_t key = GetLabelKey(address.Address, address.Type);
-
-		if(key >= 0) {
-			auto result = _codeLabels.find(key);
-			if(result != _codeLabels.end()) {
-				labelInfo = result->second;
-				return true;
+string_view LabelManager::GetLabelView(AddressInfo address, bool checkRegisterLabels)
+{
+	if(DebugUtilities::IsRelativeMemory(address.Type)) {
+		if(checkRegisterLabels) {
+			if(const LabelTableEntry* entry = FindEntry(address)) {
+				//Labels for registers
+				return entry->Label;
 			}
 		}
+		address = _debugger->GetAbsoluteAddress(address);
 	}
-	return false;
+
+	const LabelTableEntry* entry = FindEntry(address);
+	return entry ? entry->Label : string_view();
+}
+
+string_view LabelManager::GetCommentView(AddressInfo absAddress)
+{
+	const LabelTableEntry* entry = FindEntry(absAddress);
+	return entry ? entry->Comment : string_view();
+}
+
+string LabelManager::GetLabel(AddressInfo address, bool checkRegisterLabels)
+{
+	return string(GetLabelView(address, checkRegisterLabels));
+}
+
+string LabelManager::GetComment(AddressInfo absAddress)
+{
+	return string(GetCommentView(absAddress));
 }
 
 bool LabelManager::ContainsLabel(string &label)
@@ -152,15 +219,5 @@ int32_t LabelManager::GetLabelRelativeAddress(string &label, CpuType cpuType)
 
 bool LabelManager::HasLabelOrComment(AddressInfo address)
 {
-	if(DebugUtilities::IsRelativeMemory(address.Type)) {
-		address = _debugger->GetAbsoluteAddress(address);
-	}
-
-	if(address.Address >= 0) {
-		uint64_t key = GetLabelKey(address.Address, address.Type);
-		if(key >= 0) {
-			return _codeLabels.find(key) != _codeLabels.end();
-		}
-	}
-	return false;
+	return GetLabelEntry(address) != nullptr;
 }
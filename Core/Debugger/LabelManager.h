@@ -3,6 +3,7 @@
 #include <unordered_map>
 #include <functional>
 #include "Debugger/DebugTypes.h"
+#include "Debugger/DebugUtilities.h"
 
 class Debugger;
 
@@ -22,17 +23,50 @@ struct LabelInfo
 	string Comment;
 };
 
+struct LabelTableEntry
+{
+	uint32_t Address;
+	string_view Label;
+	string_view Comment;
+};
+
+struct LabelTable
+{
+	static constexpr int PageShift = 8;
+	static constexpr uint32_t PageSize = 1 << PageShift;
+
+	//Sorted by address
+	vector<LabelTableEntry> Entries;
+
+	//Page number -> page index + 1 in Pages (0 = no labels in this page)
+	vector<uint32_t> PageDirectory;
+
+	//PageSize slots per page, entry index + 1 for each address (0 = no label)
+	vector<uint32_t> Pages;
+};
+
 class LabelManager
 {
 private:
 	unordered_map<uint64_t, LabelInfo, AddressHasher> _codeLabels;
 	unordered_map<string, uint64_t> _codeLabelReverseLookup;
 
+	//Flat copy of _codeLabels (one table per memory type, indexed by address) used by the lookup functions, strings are interned in _stringPool.
+	//The lookups don't lock anything, so the tables are only rebuilt while the emulation is paused by a DebugBreakHelper,
+	//either immediately when labels change or at the end of a BeginUpdate/EndUpdate batch.
+	LabelTable _labelTables[DebugUtilities::GetMemoryTypeCount()];
+	unordered_set<string> _stringPool;
+	uint32_t _updateDepth = 0;
+	bool _tablesDirty = false;
+
 	Debugger *_debugger;
+	uint32_t _changeCount = 0;
 
 	int64_t GetLabelKey(uint32_t absoluteAddr, MemoryType memType);
 	MemoryType GetKeyMemoryType(uint64_t key);
-	bool InternalGetLabel(AddressInfo address, string& label);
+
+	void RebuildTables();
+	const LabelTableEntry* FindEntry(AddressInfo address);
 
 public:
 	LabelManager(Debugger *debugger);
@@ -40,14 +74,25 @@ public:
 	void SetLabel(uint32_t address, MemoryType memType, string label, string comment);
 	void ClearLabels();
 
+	//Defers the lookup table rebuild until EndUpdate is called (e.g while importing symbols)
+	void BeginUpdate();
+	void EndUpdate();
+
 	AddressInfo GetLabelAbsoluteAddress(string& label);
 	int32_t GetLabelRelativeAddress(string &label, CpuType cpuType);
 
 	string GetLabel(AddressInfo address, bool checkRegisterLabels = true);
 	string GetComment(AddressInfo absAddress);
-	bool GetLabelAndComment(AddressInfo address, LabelInfo &label);
+
+	//Same as the functions above, without copying the strings (the views are only valid until labels are modified)
+	string_view GetLabelView(AddressInfo address, bool checkRegisterLabels = true);
+	string_view GetCommentView(AddressInfo absAddress);
+	const LabelTableEntry* GetLabelEntry(AddressInfo address);
 
 	bool ContainsLabel(string &label);
 
 	bool HasLabelOrComment(AddressInfo address);
+
+	//Incremented every time the lookup tables are rebuilt after a label or comment is added, modified or removed
+	uint32_t GetChangeCount() { return _changeCount; }
 };
@@ -7,6 +7,7 @@
 #include "Debugger/ScriptingContext.h"
 #include "Debugger/MemoryAccessCounter.h"
 #include "Debugger/LabelManager.h"
+#include "Debugger/StateValueReader.h"
 #include "Shared/SystemActionManager.h"
 #include "Shared/Video/DebugHud.h"
 #include "Shared/Video/VideoDecoder.h"
@@ -143,6 +144,8 @@ int LuaApi::GetLibrary(lua_State *lua)
 		{ "loadSavestate", LuaApi::LoadSavestate },
 
 		{ "getState", LuaApi::GetState },
+		{ "getStateValues", LuaApi::GetStateValues },
+		{ "getLiveState", LuaApi::GetLiveState },
 		{ "setState", LuaApi::SetState },
 
 		{ "selectDrawSurface", LuaApi::SelectDrawSurface },
@@ -1004,43 +1007,114 @@ int LuaApi::LoadSavestate(lua_State* lua)
 	return l.ReturnCount();
 }
 
+void LuaApi::PushStateValue(lua_State* lua, SerializeMapValue& value)
+{
+	switch(value.Format) {
+		case SerializeMapValueFormat::Integer: lua_pushinteger(lua, value.Value.Integer); break;
+		case SerializeMapValueFormat::Double: lua_pushnumber(lua, value.Value.Double); break;
+		case SerializeMapValueFormat::Bool: lua_pushboolean(lua, value.Value.Bool); break;
+		case SerializeMapValueFormat::String: lua_pushstring(lua, value.StringValue.c_str()); break;
+	}
+}
+
+void LuaApi::PushStateTable(lua_State* lua, unordered_map<string, SerializeMapValue>& values)
+{
+	lua_newtable(lua);
+	for(auto& kvp : values) {
+		lua_pushstring(lua, kvp.first.c_str());
+		PushStateValue(lua, kvp.second);
+		lua_settable(lua, -3);
+	}
+}
+
 int LuaApi::GetState(lua_State *lua)
 {
 	LuaCallHelper l(lua);
 	checkparams();
 
-	Serializer s(0, true, SerializeFormat::Map);
-	s.Stream(*_emu->GetConsole().get(), "", -1);
-	
-	//Add some more Lua-specific values
-	uint32_t frameCount = _emu->GetFrameCount();
-	uint32_t masterClock = _emu->GetMasterClock();
-	uint32_t clockRate = _emu->GetMasterClockRate();
-	string consoleType = string(magic_enum::enum_name<ConsoleType>(_emu->GetConsoleType()));
-	string region = string(magic_enum::enum_name<ConsoleRegion>(_emu->GetRegion()));
-	
-	SV(clockRate);
-	SV(consoleType);
-	SV(region);
-	SV(frameCount);
-	SV(masterClock);
+	unordered_map<string, SerializeMapValue> values = _context->GetStateValueReader()->GetAllValues();
+	PushStateTable(lua, values);
+	return 1;
+}
 
-	unordered_map<string, SerializeMapValue>& values = s.GetMapValues();
+int LuaApi::GetStateValues(lua_State *lua)
+{
+	LuaCallHelper l(lua);
+	lua_settop(lua, 1);
+	luaL_checktype(lua, -1, LUA_TTABLE);
+
+	vector<string> keys;
+	lua_Integer count = luaL_len(lua, 1);
+	for(lua_Integer i = 1; i <= count; i++) {
+		lua_geti(lua, 1, i);
+		errorCond(lua_type(lua, -1) != LUA_TSTRING, "keys must be strings");
+		keys.push_back(lua_tostring(lua, -1));
+		lua_pop(lua, 1);
+	}
+
+	vector<std::optional<SerializeMapValue>> values = _context->GetStateValueReader()->GetValues(keys);
 
 	lua_newtable(lua);
-	for(auto& kvp : values) {
-		lua_pushstring(lua, kvp.first.c_str());
-		switch(kvp.second.Format) {
-			case SerializeMapValueFormat::Integer: lua_pushinteger(lua, kvp.second.Value.Integer); break;
-			case SerializeMapValueFormat::Double: lua_pushnumber(lua, kvp.second.Value.Double); break;
-			case SerializeMapValueFormat::Bool: lua_pushboolean(lua, kvp.second.Value.Bool); break;
-			case SerializeMapValueFormat::String: lua_pushstring(lua, kvp.second.StringValue.c_str()); break;
+	for(size_t i = 0; i < keys.size(); i++) {
+		if(values[i]) {
+			lua_pushstring(lua, keys[i].c_str());
+			PushStateValue(lua, *values[i]);
+			lua_settable(lua, -3);
 		}
-		lua_settable(lua, -3);
 	}
 	return 1;
 }
 
+int LuaApi::GetLiveState(lua_State *lua)
+{
+	LuaCallHelper l(lua);
+	checkparams();
+
+	//Empty table whose fields are read from the emulator's current state when they are accessed
+	lua_newtable(lua);
+	if(luaL_newmetatable(lua, "MesenLiveState")) {
+		lua_pushcfunction(lua, LuaApi::LiveStateIndex);
+		lua_setfield(lua, -2, "__index");
+		lua_pushcfunction(lua, LuaApi::LiveStateNewIndex);
+		lua_setfield(lua, -2, "__newindex");
+		lua_pushcfunction(lua, LuaApi::LiveStatePairs);
+		lua_setfield(lua, -2, "__pairs");
+	}
+	lua_setmetatable(lua, -2);
+	return 1;
+}
+
+int LuaApi::LiveStateIndex(lua_State* lua)
+{
+	if(lua_type(lua, 2) != LUA_TSTRING) {
+		lua_pushnil(lua);
+		return 1;
+	}
+
+	std::optional<SerializeMapValue> value = _context->GetStateValueReader()->GetValue(lua_tostring(lua, 2));
+	if(value) {
+		PushStateValue(lua, *value);
+	} else {
+		lua_pushnil(lua);
+	}
+	return 1;
+}
+
+int LuaApi::LiveStateNewIndex(lua_State* lua)
+{
+	error("live state is read-only, use emu.setState to modify the state");
+}
+
+int LuaApi::LiveStatePairs(lua_State* lua)
+{
+	//Iterating requires every value, return a snapshot of the whole state
+	unordered_map<string, SerializeMapValue> values = _context->GetStateValueReader()->GetAllValues();
+	lua_getglobal(lua, "next");
+	PushStateTable(lua, values);
+	lua_pushnil(lua);
+	return 3;
+}
+
 int LuaApi::SetState(lua_State* lua)
 {
 	LuaCallHelper l(lua);
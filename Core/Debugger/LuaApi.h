@@ -11,6 +11,7 @@ class Emulator;
 class MemoryDumper;
 class DebugHud;
 class BaseVideoFilter;
+struct SerializeMapValue;
 
 class LuaApi
 {
@@ -84,6 +85,8 @@ public:
 
 	static int SetState(lua_State *lua);
 	static int GetState(lua_State *lua);
+	static int GetStateValues(lua_State *lua);
+	static int GetLiveState(lua_State *lua);
 
 	static int GetAccessCounters(lua_State *lua);
 	static int ResetAccessCounters(lua_State *lua);
@@ -91,6 +94,12 @@ public:
 private:
 	static FrameInfo InternalGetScreenSize();
 
+	static void PushStateValue(lua_State* lua, SerializeMapValue& value);
+	static void PushStateTable(lua_State* lua, unordered_map<string, SerializeMapValue>& values);
+	static int LiveStateIndex(lua_State* lua);
+	static int LiveStateNewIndex(lua_State* lua);
+	static int LiveStatePairs(lua_State* lua);
+
 	static Emulator* _emu;
 	static Debugger* _debugger;
 	static MemoryDumper* _memoryDumper;
@@ -13,17 +13,25 @@
 #include "SNES/BaseCartridge.h"
 #include "Gameboy/Gameboy.h"
 
+std::atomic<uint32_t> MemoryAccessCounter::_changeGeneration(1);
+
 MemoryAccessCounter::MemoryAccessCounter(Debugger* debugger)
 {
 	_debugger = debugger;
 
+	//Pages are only allocated once they are accessed - most of the ROM/RAM is never touched in a typical session
 	for(int i = (int)DebugUtilities::GetLastCpuMemoryType() + 1; i < DebugUtilities::GetMemoryTypeCount(); i++) {
 		uint32_t memSize = _debugger->GetMemoryDumper()->GetMemorySize((MemoryType)i);
-		_counters[i].reserve(memSize);
-		for(uint32_t j = 0; j < memSize; j++) {
-			_counters[i].push_back({});
+		_memSize[i] = memSize;
+		uint32_t pageCount = (memSize + PageMask) >> PageShift;
+		for(int j = 0; j < AccessIndexCount; j++) {
+			_counters[i][j].Init(pageCount);
+			_stamps[i][j].Init(pageCount);
 		}
+		_changeGenerations[i].resize((memSize + ChangePageSize - 1) >> ChangePageShift);
 	}
+
+	InvalidateChanges();
 }
 
 ReadResult MemoryAccessCounter::ProcessMemoryRead(AddressInfo &addressInfo, uint64_t masterClock)
@@ -32,17 +40,13 @@ ReadResult MemoryAccessCounter::ProcessMemoryRead(AddressInfo &addressInfo, uint
 		return ReadResult::Normal;
 	}
 
-	AddressCounters& counts = _counters[(int)addressInfo.Type][addressInfo.Address];
-	if(counts.WriteStamp == 0 && DebugUtilities::IsVolatileRam(addressInfo.Type)) {
-		ReadResult result = counts.ReadStamp == 0 ? ReadResult::FirstUninitRead : ReadResult::UninitRead;
-		counts.ReadStamp = masterClock;
-		counts.ReadCounter++;
-		return result;
+	ReadResult result = ReadResult::Normal;
+	if(DebugUtilities::IsVolatileRam(addressInfo.Type) && GetStamp(addressInfo.Type, AccessIndex::Write, addressInfo.Address) == 0) {
+		result = GetStamp(addressInfo.Type, AccessIndex::Read, addressInfo.Address) == 0 ? ReadResult::FirstUninitRead : ReadResult::UninitRead;
 	}
 
-	counts.ReadStamp = masterClock;
-	counts.ReadCounter++;
-	return ReadResult::Normal;
+	IncrementCounter(addressInfo.Type, AccessIndex::Read, addressInfo.Address, masterClock);
+	return result;
 }
 
 void MemoryAccessCounter::ProcessMemoryWrite(AddressInfo& addressInfo, uint64_t masterClock)
@@ -51,9 +55,9 @@ void MemoryAccessCounter::ProcessMemoryWrite(AddressInfo& addressInfo, uint64_t
 		return;
 	}
 
-	AddressCounters& counts = _counters[(int)addressInfo.Type][addressInfo.Address];
-	counts.WriteStamp = masterClock;
-	counts.WriteCounter++;
+	IncrementCounter(addressInfo.Type, AccessIndex::Write, addressInfo.Address, masterClock);
+
+	MarkPageChanged(addressInfo.Type, addressInfo.Address);
 }
 
 void MemoryAccessCounter::ProcessMemoryExec(AddressInfo& addressInfo, uint64_t masterClock)
@@ -62,17 +66,47 @@ void MemoryAccessCounter::ProcessMemoryExec(AddressInfo& addressInfo, uint64_t m
 		return;
 	}
 
-	AddressCounters& counts = _counters[(int)addressInfo.Type][addressInfo.Address];
-	counts.ExecStamp = masterClock;
-	counts.ExecCounter++;
+	IncrementCounter(addressInfo.Type, AccessIndex::Exec, addressInfo.Address, masterClock);
 }
 
 void MemoryAccessCounter::ResetCounts()
 {
 	DebugBreakHelper helper(_debugger);
+
+	//Clear the pages rather than freeing them, GetAccessCounts may be reading them from another thread
 	for(int i = 0; i < DebugUtilities::GetMemoryTypeCount(); i++) {
-		memset(_counters[i].data(), 0, _counters[i].size() * sizeof(AddressCounters));
+		for(int j = 0; j < AccessIndexCount; j++) {
+			_counters[i][j].Clear();
+			_stamps[i][j].Clear();
+		}
+	}
+
+	//Called on reset and when a state is loaded - any part of memory may have changed
+	InvalidateChanges();
+}
+
+AddressCounters MemoryAccessCounter::GetCounters(MemoryType memType, uint32_t address)
+{
+	AddressCounters counts = {};
+	uint32_t offset = address & PageMask;
+	uint32_t* counters[AccessIndexCount] = {};
+	for(int i = 0; i < AccessIndexCount; i++) {
+		counters[i] = _counters[(int)memType][i].FindPage(address);
+	}
+
+	if(counters[AccessIndex::Read]) {
+		counts.ReadCounter = counters[AccessIndex::Read][offset];
+		counts.ReadStamp = GetStamp(memType, AccessIndex::Read, address);
 	}
+	if(counters[AccessIndex::Write]) {
+		counts.WriteCounter = counters[AccessIndex::Write][offset];
+		counts.WriteStamp = GetStamp(memType, AccessIndex::Write, address);
+	}
+	if(counters[AccessIndex::Exec]) {
+		counts.ExecCounter = counters[AccessIndex::Exec][offset];
+		counts.ExecStamp = GetStamp(memType, AccessIndex::Exec, address);
+	}
+	return counts;
 }
 
 void MemoryAccessCounter::GetAccessCounts(uint32_t offset, uint32_t length, MemoryType memoryType, AddressCounters counts[])
@@ -84,12 +118,91 @@ void MemoryAccessCounter::GetAccessCounts(uint32_t offset, uint32_t length, Memo
 			addr.Address = offset + i;
 			AddressInfo info = _debugger->GetAbsoluteAddress(addr);
 			if(info.Address >= 0) {
-				counts[i] = _counters[(int)info.Type][info.Address];
+				counts[i] = GetCounters(info.Type, info.Address);
 			}
 		}
 	} else {
-		if(offset + length <= _counters[(int)memoryType].size()) {
-			memcpy(counts, _counters[(int)memoryType].data() + offset, length * sizeof(AddressCounters));
+		if(offset + length <= _memSize[(int)memoryType]) {
+			for(uint32_t i = 0; i < length; i++) {
+				counts[i] = GetCounters(memoryType, offset + i);
+			}
 		}
 	}
 }
+
+void MemoryAccessCounter::InvalidateChanges()
+{
+	uint32_t generation = _changeGeneration;
+	for(int i = 0; i < DebugUtilities::GetMemoryTypeCount(); i++) {
+		std::fill(_changeGenerations[i].begin(), _changeGenerations[i].end(), generation);
+	}
+}
+
+void MemoryAccessCounter::MarkChanged(MemoryType memoryType, uint32_t address, uint32_t length)
+{
+	if(length == 0 || (uint64_t)address + length > _memSize[(int)memoryType]) {
+		return;
+	}
+
+	uint32_t lastPage = (address + length - 1) >> ChangePageShift;
+	for(uint32_t page = address >> ChangePageShift; page <= lastPage; page++) {
+		MarkPageChanged(memoryType, page << ChangePageShift);
+	}
+}
+
+bool MemoryAccessCounter::IsPageChanged(MemoryType memType, uint32_t address, uint32_t sinceGeneration)
+{
+	if(DebugUtilities::IsRelativeMemory(memType)) {
+		//Map the start and end of the page - mappings are never smaller than a page, except for registers (no absolute address), which are always considered changed
+		AddressInfo relAddr = { (int32_t)address, memType };
+		for(uint32_t offset : { (uint32_t)0, ChangePageSize - 1 }) {
+			relAddr.Address = address + offset;
+			AddressInfo absAddr = _debugger->GetAbsoluteAddress(relAddr);
+			if(absAddr.Address < 0 || DebugUtilities::IsRelativeMemory(absAddr.Type) || IsPageChanged(absAddr.Type, absAddr.Address, sinceGeneration)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	//Pages stamped with sinceGeneration itself were written while (or right before) that generation was returned,
+	//their content may have been read before the write was applied, so they must be reported as changed
+	return _changeGenerations[(int)memType][address >> ChangePageShift] >= sinceGeneration;
+}
+
+uint32_t MemoryAccessCounter::GetMemoryChanges(MemoryType memoryType, uint32_t sinceGeneration, MemoryChangeRange ranges[], uint32_t maxRangeCount, uint32_t& rangeCount)
+{
+	//Writes stamped with the returned generation (or a newer one) are included in the next call, this covers
+	//writes that occur while the pages are being checked (at worst, a page is reported as changed twice)
+	uint32_t generation = _changeGeneration++;
+
+	rangeCount = 0;
+	uint32_t size = _debugger->GetMemoryDumper()->GetMemorySize(memoryType);
+	if(size == 0 || maxRangeCount == 0) {
+		return generation;
+	}
+
+	if(sinceGeneration == 0) {
+		ranges[0] = { 0, size - 1 };
+		rangeCount = 1;
+		return generation;
+	}
+
+	for(uint32_t addr = 0; addr < size; addr += ChangePageSize) {
+		if(!IsPageChanged(memoryType, addr, sinceGeneration)) {
+			continue;
+		}
+
+		uint32_t end = std::min(addr + ChangePageSize, size) - 1;
+		if(rangeCount > 0 && ranges[rangeCount - 1].End + 1 == addr) {
+			ranges[rangeCount - 1].End = end;
+		} else if(rangeCount < maxRangeCount) {
+			ranges[rangeCount++] = { addr, end };
+		} else {
+			//Out of space, extend the last range to cover everything that remains
+			ranges[rangeCount - 1].End = end;
+		}
+	}
+
+	return generation;
+}
@@ -23,6 +23,12 @@ struct AddressCounters
 	uint32_t ExecCounter;
 };
 
+struct MemoryChangeRange
+{
+	uint32_t Start;
+	uint32_t End;
+};
+
 enum class ReadResult
 {
 	Normal,
@@ -33,10 +39,113 @@ enum class ReadResult
 class MemoryAccessCounter
 {
 private:
-	vector<AddressCounters> _counters[DebugUtilities::GetMemoryTypeCount()];
+	static constexpr uint32_t PageShift = 12;
+	static constexpr uint32_t PageSize = 1 << PageShift;
+	static constexpr uint32_t PageMask = PageSize - 1;
+
+	enum AccessIndex
+	{
+		Read = 0,
+		Write = 1,
+		Exec = 2,
+		AccessIndexCount = 3
+	};
+
+	//Lazily allocated pages of T (one per PageSize bytes of memory), for a single memory type and access type.
+	//Pages are allocated on the emulation thread and published with release/acquire semantics, since
+	//GetAccessCounts reads them from the UI thread. Allocated pages are never freed until the counter is destroyed.
+	template<typename T>
+	class PageTable
+	{
+	private:
+		unique_ptr<std::atomic<T*>[]> _pages;
+		uint32_t _pageCount = 0;
+
+	public:
+		~PageTable()
+		{
+			for(uint32_t i = 0; i < _pageCount; i++) {
+				delete[] _pages[i].load(std::memory_order_relaxed);
+			}
+		}
+
+		void Init(uint32_t pageCount)
+		{
+			_pageCount = pageCount;
+			_pages.reset(new std::atomic<T*>[pageCount]());
+		}
+
+		__forceinline T* GetPage(uint32_t address)
+		{
+			std::atomic<T*>& slot = _pages[address >> PageShift];
+			T* page = slot.load(std::memory_order_acquire);
+			if(!page) {
+				T* newPage = new T[PageSize]();
+				if(slot.compare_exchange_strong(page, newPage, std::memory_order_acq_rel, std::memory_order_acquire)) {
+					page = newPage;
+				} else {
+					//Another thread (e.g a coprocessor running on its own thread) allocated the page first
+					delete[] newPage;
+				}
+			}
+			return page;
+		}
+
+		__forceinline T* FindPage(uint32_t address)
+		{
+			return _pages[address >> PageShift].load(std::memory_order_acquire);
+		}
+
+		void Clear()
+		{
+			for(uint32_t i = 0; i < _pageCount; i++) {
+				if(T* page = _pages[i].load(std::memory_order_acquire)) {
+					memset(page, 0, sizeof(T) * PageSize);
+				}
+			}
+		}
+	};
+
+	//Counters and stamps are kept in separate pages, for each access type: the stamps (8 bytes per byte) are only
+	//allocated for the pages that were accessed, and reading/resetting the counters doesn't touch them.
+	PageTable<uint32_t> _counters[DebugUtilities::GetMemoryTypeCount()][AccessIndexCount];
+	PageTable<uint64_t> _stamps[DebugUtilities::GetMemoryTypeCount()][AccessIndexCount];
+	uint32_t _memSize[DebugUtilities::GetMemoryTypeCount()] = {};
+
+	//Write generation of each 256-byte page, used to let tools only copy the parts of memory that changed
+	static constexpr uint32_t ChangePageShift = 8;
+	static constexpr uint32_t ChangePageSize = 1 << ChangePageShift;
+	//The generation counter is shared by all instances, so generations returned by a previous debugger/game are never reused
+	vector<uint32_t> _changeGenerations[DebugUtilities::GetMemoryTypeCount()];
+	static std::atomic<uint32_t> _changeGeneration;
 
 	Debugger* _debugger;
 
+	__forceinline void IncrementCounter(MemoryType memType, AccessIndex access, uint32_t address, uint64_t masterClock)
+	{
+		uint32_t offset = address & PageMask;
+		_counters[(int)memType][access].GetPage(address)[offset]++;
+		_stamps[(int)memType][access].GetPage(address)[offset] = masterClock;
+	}
+
+	__forceinline uint64_t GetStamp(MemoryType memType, AccessIndex access, uint32_t address)
+	{
+		uint64_t* stamps = _stamps[(int)memType][access].FindPage(address);
+		return stamps ? stamps[address & PageMask] : 0;
+	}
+
+	AddressCounters GetCounters(MemoryType memType, uint32_t address);
+
+	//Called by ProcessMemoryWrite, before the write is applied to memory - pages are stamped with the current generation,
+	//and IsPageChanged() reports pages stamped with the generation it is given, so the page is reported again by the call
+	//that follows the one that may have copied the page's content before the write landed
+	__forceinline void MarkPageChanged(MemoryType memType, uint32_t address)
+	{
+		_changeGenerations[(int)memType][address >> ChangePageShift] = _changeGeneration.load(std::memory_order_relaxed);
+	}
+
+	void InvalidateChanges();
+
 public:
 	MemoryAccessCounter(Debugger *debugger);
 
@@ -47,4 +156,14 @@ public:
 	void ResetCounts();
 
 	void GetAccessCounts(uint32_t offset, uint32_t length, MemoryType memoryType, AddressCounters counts[]);
+
+	void MarkChanged(MemoryType memoryType, uint32_t address, uint32_t length);
+
+	//Returns the current generation and starts a new one - pages changed during or after this call are reported by IsPageChanged(..., generation)
+	uint32_t NextChangeGeneration() { return _changeGeneration++; }
+	bool IsPageChanged(MemoryType memType, uint32_t address, uint32_t sinceGeneration);
+
+	//Returns the ranges that were written to since the specified generation (0 returns the entire memory)
+	//The return value is the generation to pass to the next call.
+	uint32_t GetMemoryChanges(MemoryType memoryType, uint32_t sinceGeneration, MemoryChangeRange ranges[], uint32_t maxRangeCount, uint32_t& rangeCount);
 };
\ No newline at end of file
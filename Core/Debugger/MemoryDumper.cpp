@@ -22,6 +22,7 @@
 #include "Debugger/DebugBreakHelper.h"
 #include "Debugger/DebugUtilities.h"
 #include "Debugger/Disassembler.h"
+#include "Debugger/MemoryAccessCounter.h"
 
 MemoryDumper::MemoryDumper(Debugger* debugger)
 {
@@ -60,6 +61,7 @@ void MemoryDumper::SetMemoryState(MemoryType type, uint8_t *buffer, uint32_t len
 	uint8_t* dst = GetMemoryBuffer(type);
 	if(dst) {
 		memcpy(dst, buffer, length);
+		_debugger->GetMemoryAccessCounter()->MarkChanged(type, 0, length);
 	}
 }
 
@@ -232,6 +234,14 @@ void MemoryDumper::SetMemoryValue(MemoryType memoryType, uint32_t address, uint8
 			}
 			break;
 	}
+
+	AddressInfo absAddr = { (int32_t)address, memoryType };
+	if(DebugUtilities::IsRelativeMemory(memoryType)) {
+		absAddr = _debugger->GetAbsoluteAddress(absAddr);
+	}
+	if(absAddr.Address >= 0 && !DebugUtilities::IsRelativeMemory(absAddr.Type)) {
+		_debugger->GetMemoryAccessCounter()->MarkChanged(absAddr.Type, absAddr.Address, 1);
+	}
 }
 
 void MemoryDumper::GetMemoryValues(MemoryType memoryType, uint32_t start, uint32_t end, uint8_t* output)
@@ -8,6 +8,7 @@
 #include "Debugger/DebugTypes.h"
 #include "Debugger/Debugger.h"
 #include "Debugger/ScriptManager.h"
+#include "Debugger/StateValueReader.h"
 #include "Shared/Emulator.h"
 #include "Shared/EmuSettings.h"
 #include "Shared/SaveStateManager.h"
@@ -22,6 +23,7 @@ ScriptingContext::ScriptingContext(Debugger *debugger)
 	_settings = debugger->GetEmulator()->GetSettings();
 	_defaultCpuType = debugger->GetEmulator()->GetCpuTypes()[0];
 	_defaultMemType = DebugUtilities::GetCpuMemoryType(_defaultCpuType);
+	_stateReader.reset(new StateValueReader(debugger->GetEmulator()));
 }
 
 ScriptingContext::~ScriptingContext()
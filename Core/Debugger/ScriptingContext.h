@@ -7,6 +7,7 @@
 #include "Shared/EventType.h"
 
 class Debugger;
+class StateValueReader;
 struct lua_State;
 
 enum class CallbackType
@@ -49,6 +50,8 @@ private:
 
 	ScriptDrawSurface _drawSurface = ScriptDrawSurface::ConsoleScreen;
 
+	unique_ptr<StateValueReader> _stateReader;
+
 	static void ExecutionCountHook(lua_State* lua);
 	void LuaOpenLibs(lua_State* L, bool allowIoOsAccess);
 
@@ -77,6 +80,8 @@ public:
 	void SetDrawSurface(ScriptDrawSurface surface) { _drawSurface = surface; }
 	ScriptDrawSurface GetDrawSurface() { return _drawSurface; }
 
+	StateValueReader* GetStateValueReader() { return _stateReader.get(); }
+
 	template<typename T> void CallMemoryCallback(AddressInfo relAddr, T& value, CallbackType type, CpuType cpuType);
 	int CallEventCallback(EventType type, CpuType cpuType);
 	bool CheckInitDone();
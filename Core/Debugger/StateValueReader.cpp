@@ -0,0 +1,85 @@
+#include "pch.h"
+#include "Debugger/StateValueReader.h"
+#include "Shared/Emulator.h"
+#include "Shared/Interfaces/IConsole.h"
+#include "Utilities/magic_enum.hpp"
+
+StateValueReader::StateValueReader(Emulator* emu)
+{
+	_emu = emu;
+}
+
+std::optional<SerializeMapValue> StateValueReader::GetExtraValue(const string& key)
+{
+	//Lua-specific values added by GetAllValues()
+	if(key == "clockRate") {
+		return SerializeMapValue(SerializeMapValueFormat::Integer, (int64_t)_emu->GetMasterClockRate());
+	} else if(key == "consoleType") {
+		return SerializeMapValue(string(magic_enum::enum_name<ConsoleType>(_emu->GetConsoleType())));
+	} else if(key == "region") {
+		return SerializeMapValue(string(magic_enum::enum_name<ConsoleRegion>(_emu->GetRegion())));
+	} else if(key == "frameCount") {
+		return SerializeMapValue(SerializeMapValueFormat::Integer, (int64_t)_emu->GetFrameCount());
+	} else if(key == "masterClock") {
+		return SerializeMapValue(SerializeMapValueFormat::Integer, (int64_t)(uint32_t)_emu->GetMasterClock());
+	}
+	return std::nullopt;
+}
+
+std::optional<SerializeMapValue> StateValueReader::GetValue(const string& key)
+{
+	return GetValues({ key })[0];
+}
+
+vector<std::optional<SerializeMapValue>> StateValueReader::GetValues(const vector<string>& keys)
+{
+	//Values are always read through the serializer (no pointers to the console's fields are kept, since the
+	//objects that contain them can be replaced at any time, e.g when loading a state or changing controllers).
+	//The key filter skips every object that can't contain one of the requested keys.
+	unordered_map<string, SerializeMapValue> mapValues;
+	shared_ptr<IConsole> console = _emu->GetConsole();
+	if(console && !keys.empty()) {
+		Serializer s(0, true, SerializeFormat::Map);
+		s.SetMapKeyFilter(keys);
+		s.Stream(*console.get(), "", -1);
+		mapValues = std::move(s.GetMapValues());
+	}
+
+	vector<std::optional<SerializeMapValue>> values;
+	values.reserve(keys.size());
+	for(const string& key : keys) {
+		auto result = mapValues.find(key);
+		if(result != mapValues.end()) {
+			values.push_back(result->second);
+		} else {
+			values.push_back(GetExtraValue(key));
+		}
+	}
+	return values;
+}
+
+unordered_map<string, SerializeMapValue> StateValueReader::GetAllValues()
+{
+	shared_ptr<IConsole> console = _emu->GetConsole();
+	if(!console) {
+		return {};
+	}
+
+	Serializer s(0, true, SerializeFormat::Map);
+	s.Stream(*console.get(), "", -1);
+
+	//Add some more Lua-specific values
+	uint32_t frameCount = _emu->GetFrameCount();
+	uint32_t masterClock = _emu->GetMasterClock();
+	uint32_t clockRate = _emu->GetMasterClockRate();
+	string consoleType = string(magic_enum::enum_name<ConsoleType>(_emu->GetConsoleType()));
+	string region = string(magic_enum::enum_name<ConsoleRegion>(_emu->GetRegion()));
+
+	SV(clockRate);
+	SV(consoleType);
+	SV(region);
+	SV(frameCount);
+	SV(masterClock);
+
+	return std::move(s.GetMapValues());
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include "pch.h"
+#include <optional>
+#include "Utilities/Serializer.h"
+
+class Emulator;
+
+//Reads individual state values (same keys as the Map serialization used by emu.getState)
+//Values are always read through a Map serialization restricted to the requested keys - objects that can't contain
+//any of these keys are skipped, but no field offsets are cached, so each call still walks the console's object tree
+class StateValueReader
+{
+private:
+	Emulator* _emu = nullptr;
+
+	std::optional<SerializeMapValue> GetExtraValue(const string& key);
+
+public:
+	StateValueReader(Emulator* emu);
+
+	std::optional<SerializeMapValue> GetValue(const string& key);
+	vector<std::optional<SerializeMapValue>> GetValues(const vector<string>& keys);
+	unordered_map<string, SerializeMapValue> GetAllValues();
+};
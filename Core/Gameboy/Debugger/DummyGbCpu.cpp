@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "Gameboy/Debugger/DummyGbCpu.h"
+#include "Debugger/CpuTestBus.h"
 
 #define DUMMYCPU
 #define GbCpu DummyGbCpu
@@ -103,7 +103,7 @@ void GameboyDisUtils::GetDisassembly(DisassemblyInfo& info, string& out, uint32_
 	AddressInfo addrInfo { 0, MemoryType::GameboyMemory };
 	auto getOperand = [&str, &addrInfo, labelManager](uint16_t addr) {
 		addrInfo.Address = addr;
-		string label = labelManager ? labelManager->GetLabel(addrInfo) :"";
+		string_view label = labelManager ? labelManager->GetLabelView(addrInfo) : string_view();
 		if(label.empty()) {
 			str.WriteAll('$', HexUtilities::ToHex(addr));
 		} else {
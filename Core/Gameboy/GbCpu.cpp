@@ -34,7 +34,12 @@ bool GbCpu::IsHalted()
 
 void GbCpu::Exec()
 {
+#ifdef DUMMYCPU
+	//There are no IRQ sources on the test bus
+	uint8_t irqVector = _testBus ? 0 : _memoryManager->ProcessIrqRequests();
+#else
 	uint8_t irqVector = _memoryManager->ProcessIrqRequests();
+#endif
 	if(irqVector) {
 		if(_state.IME) {
 #ifndef DUMMYCPU
@@ -415,6 +420,9 @@ template<MemoryOperationType type>
 uint8_t GbCpu::ReadMemory(uint16_t addr)
 {
 #ifdef DUMMYCPU
+	if(_testBus) {
+		return _testBus->Read(addr, type);
+	}
 	uint8_t value = _memoryManager->DebugRead(addr);
 	LogMemoryOperation(addr, value, type);
 	return value;
@@ -427,7 +435,11 @@ void GbCpu::Write(uint16_t addr, uint8_t value)
 {
 	HalfCycle();
 #ifdef DUMMYCPU
-	LogMemoryOperation(addr, value, MemoryOperationType::Write);
+	if(_testBus) {
+		_testBus->Write(addr, value, MemoryOperationType::Write);
+	} else {
+		LogMemoryOperation(addr, value, MemoryOperationType::Write);
+	}
 #else
 	_memoryManager->Write(addr, value);
 #endif
@@ -14,6 +14,7 @@
 class GbMemoryManager;
 class Gameboy;
 class Emulator;
+struct CpuTestBus;
 
 class GbCpu : public ISerializable
 {
@@ -168,9 +169,11 @@ public:
 private:
 	uint32_t _memOpCounter = 0;
 	MemoryOperationInfo _memOperations[10] = {};
+	CpuTestBus* _testBus = nullptr;
 
 public:
 	void SetDummyState(GbCpuState& state);
+	void SetTestBus(CpuTestBus* testBus) { _testBus = testBus; }
 	uint32_t GetOperationCount();
 	void LogMemoryOperation(uint32_t addr, uint8_t value, MemoryOperationType type);
 	MemoryOperationInfo GetOperationInfo(uint32_t index);
@@ -163,10 +163,13 @@ uint8_t GbMemoryManager::Read(uint16_t addr)
 	} else if(_reads[addr >> 8]) {
 		value = _reads[addr >> 8][(uint8_t)addr];
 	}
-	if(_emu->GetCheatManager()->HasCheats<CpuType::Gameboy>()) {
-		_emu->GetCheatManager()->ApplyCheat<CpuType::Gameboy>(addr, value);
+	uint8_t instrumentation = _emu->GetInstrumentation();
+	if(instrumentation) {
+		if(instrumentation & InstrumentationFlags::Cheats) {
+			_emu->GetCheatManager()->ApplyCheat<CpuType::Gameboy>(addr, value);
+		}
+		_emu->ProcessMemoryRead<CpuType::Gameboy>(instrumentation, addr, value, opType);
 	}
-	_emu->ProcessMemoryRead<CpuType::Gameboy>(addr, value, opType);
 	return value;
 }
 
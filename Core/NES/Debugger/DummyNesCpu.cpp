@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "NES/NesCpu.h"
 #include "NES/Debugger/DummyNesCpu.h"
+#include "Debugger/CpuTestBus.h"
 
 #define DUMMYCPU
 #define NesCpu DummyNesCpu
@@ -27,6 +28,25 @@ void DummyNesCpu::SetDummyState(NesCpu* c)
 	_runIrq = c->_runIrq;
 }
 
+void DummyNesCpu::SetDummyState(NesCpuState& state)
+{
+	_memOpCounter = 0;
+
+	_state = state;
+
+	_operand = 0;
+	_spriteDmaTransfer = false;
+	_needHalt = false;
+	_dmcDmaRunning = false;
+	_cpuWrite = false;
+	_needDummyRead = false;
+	_prevNeedNmi = false;
+	_needNmi = false;
+	_irqMask = 0;
+	_prevRunIrq = false;
+	_runIrq = false;
+}
+
 uint32_t DummyNesCpu::GetOperationCount()
 {
 	return _memOpCounter;
@@ -94,7 +94,7 @@ void NesDisUtils::GetDisassembly(DisassemblyInfo& info, string& out, uint32_t me
 	if(opSize > 1) {
 		if(addrMode != NesAddrMode::Imm) {
 			AddressInfo address { (int32_t)opAddr, MemoryType::NesMemory };
-			string label = labelManager ? labelManager->GetLabel(address, !info.IsJump()) : "";
+			string_view label = labelManager ? labelManager->GetLabelView(address, !info.IsJump()) : string_view();
 			if(label.size()) {
 				operand.Write(label, true);
 			}
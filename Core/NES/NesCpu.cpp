@@ -13,56 +13,54 @@
 #include "Shared/Emulator.h"
 #include "Shared/MemoryOperationType.h"
 
+typedef NesCpu C;
+NesCpu::Func const NesCpu::_opTable[] = {
+//	0					1					2					3					4					5					6							7					8					9					A							B					C							D					E							F
+	&C::BRK,	&C::ORA,	&C::HLT,	&C::SLO,	&C::NOP,	&C::ORA,	&C::ASL_Memory,	&C::SLO,	&C::PHP,	&C::ORA,	&C::ASL_Acc,		&C::AAC,	&C::NOP,			&C::ORA,	&C::ASL_Memory,	&C::SLO, //0
+	&C::BPL,	&C::ORA,	&C::HLT,	&C::SLO,	&C::NOP,	&C::ORA,	&C::ASL_Memory,	&C::SLO,	&C::CLC,	&C::ORA,	&C::NOP,			&C::SLO,	&C::NOP,			&C::ORA,	&C::ASL_Memory,	&C::SLO, //1
+	&C::JSR,	&C::AND,	&C::HLT,	&C::RLA,	&C::BIT,	&C::AND,	&C::ROL_Memory,	&C::RLA,	&C::PLP,	&C::AND,	&C::ROL_Acc,		&C::AAC,	&C::BIT,			&C::AND,	&C::ROL_Memory,	&C::RLA, //2
+	&C::BMI,	&C::AND,	&C::HLT,	&C::RLA,	&C::NOP,	&C::AND,	&C::ROL_Memory,	&C::RLA,	&C::SEC,	&C::AND,	&C::NOP,			&C::RLA,	&C::NOP,			&C::AND,	&C::ROL_Memory,	&C::RLA, //3
+	&C::RTI,	&C::EOR,	&C::HLT,	&C::SRE,	&C::NOP,	&C::EOR,	&C::LSR_Memory,	&C::SRE,	&C::PHA,	&C::EOR,	&C::LSR_Acc,		&C::ASR,	&C::JMP_Abs,		&C::EOR,	&C::LSR_Memory,	&C::SRE, //4
+	&C::BVC,	&C::EOR,	&C::HLT,	&C::SRE,	&C::NOP,	&C::EOR,	&C::LSR_Memory,	&C::SRE,	&C::CLI,	&C::EOR,	&C::NOP,			&C::SRE,	&C::NOP,			&C::EOR,	&C::LSR_Memory,	&C::SRE, //5
+	&C::RTS,	&C::ADC,	&C::HLT,	&C::RRA,	&C::NOP,	&C::ADC,	&C::ROR_Memory,	&C::RRA,	&C::PLA,	&C::ADC,	&C::ROR_Acc,		&C::ARR,	&C::JMP_Ind,		&C::ADC,	&C::ROR_Memory,	&C::RRA, //6
+	&C::BVS,	&C::ADC,	&C::HLT,	&C::RRA,	&C::NOP,	&C::ADC,	&C::ROR_Memory,	&C::RRA,	&C::SEI,	&C::ADC,	&C::NOP,			&C::RRA,	&C::NOP,			&C::ADC,	&C::ROR_Memory,	&C::RRA, //7
+	&C::NOP,	&C::STA,	&C::NOP,	&C::SAX,	&C::STY,	&C::STA,	&C::STX,			&C::SAX,	&C::DEY,	&C::NOP,	&C::TXA,			&C::UNK,	&C::STY,			&C::STA,	&C::STX,			&C::SAX, //8
+	&C::BCC,	&C::STA,	&C::HLT,	&C::AXA,	&C::STY,	&C::STA,	&C::STX,			&C::SAX,	&C::TYA,	&C::STA,	&C::TXS,			&C::TAS,	&C::SYA,			&C::STA,	&C::SXA,			&C::AXA, //9
+	&C::LDY,	&C::LDA,	&C::LDX,	&C::LAX,	&C::LDY,	&C::LDA,	&C::LDX,			&C::LAX,	&C::TAY,	&C::LDA,	&C::TAX,			&C::ATX,	&C::LDY,			&C::LDA,	&C::LDX,			&C::LAX, //A
+	&C::BCS,	&C::LDA,	&C::HLT,	&C::LAX,	&C::LDY,	&C::LDA,	&C::LDX,			&C::LAX,	&C::CLV,	&C::LDA,	&C::TSX,			&C::LAS,	&C::LDY,			&C::LDA,	&C::LDX,			&C::LAX, //B
+	&C::CPY,	&C::CPA,	&C::NOP,	&C::DCP,	&C::CPY,	&C::CPA,	&C::DEC,			&C::DCP,	&C::INY,	&C::CPA,	&C::DEX,			&C::AXS,	&C::CPY,			&C::CPA,	&C::DEC,			&C::DCP, //C
+	&C::BNE,	&C::CPA,	&C::HLT,	&C::DCP,	&C::NOP,	&C::CPA,	&C::DEC,			&C::DCP,	&C::CLD,	&C::CPA,	&C::NOP,			&C::DCP,	&C::NOP,			&C::CPA,	&C::DEC,			&C::DCP, //D
+	&C::CPX,	&C::SBC,	&C::NOP,	&C::ISB,	&C::CPX,	&C::SBC,	&C::INC,			&C::ISB,	&C::INX,	&C::SBC,	&C::NOP,			&C::SBC,	&C::CPX,			&C::SBC,	&C::INC,			&C::ISB, //E
+	&C::BEQ,	&C::SBC,	&C::HLT,	&C::ISB,	&C::NOP,	&C::SBC,	&C::INC,			&C::ISB,	&C::SED,	&C::SBC,	&C::NOP,			&C::ISB,	&C::NOP,			&C::SBC,	&C::INC,			&C::ISB  //F
+};
+
+typedef NesAddrMode M;
+NesAddrMode const NesCpu::_addrMode[] = {
+//	0			1				2			3				4				5				6				7				8			9			A			B			C			D			E			F
+	M::Imp,	M::IndX,		M::None,	M::IndX,		M::Zero,		M::Zero,		M::Zero,		M::Zero,		M::Imp,	M::Imm,	M::Acc,	M::Imm,	M::Abs,	M::Abs,	M::Abs,	M::Abs,	//0
+	M::Rel,	M::IndY,		M::None,	M::IndYW,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::Imp,	M::AbsY,	M::Imp,	M::AbsYW,M::AbsX,	M::AbsX,	M::AbsXW,M::AbsXW,//1
+	M::Abs,	M::IndX,		M::None,	M::IndX,		M::Zero,		M::Zero,		M::Zero,		M::Zero,		M::Imp,	M::Imm,	M::Acc,	M::Imm,	M::Abs,	M::Abs,	M::Abs,	M::Abs,	//2
+	M::Rel,	M::IndY,		M::None,	M::IndYW,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::Imp,	M::AbsY,	M::Imp,	M::AbsYW,M::AbsX,	M::AbsX,	M::AbsXW,M::AbsXW,//3
+	M::Imp,	M::IndX,		M::None,	M::IndX,		M::Zero,		M::Zero,		M::Zero,		M::Zero,		M::Imp,	M::Imm,	M::Acc,	M::Imm,	M::Abs,	M::Abs,	M::Abs,	M::Abs,	//4
+	M::Rel,	M::IndY,		M::None,	M::IndYW,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::Imp,	M::AbsY,	M::Imp,	M::AbsYW,M::AbsX,	M::AbsX,	M::AbsXW,M::AbsXW,//5
+	M::Imp,	M::IndX,		M::None,	M::IndX,		M::Zero,		M::Zero,		M::Zero,		M::Zero,		M::Imp,	M::Imm,	M::Acc,	M::Imm,	M::Ind,	M::Abs,	M::Abs,	M::Abs,	//6
+	M::Rel,	M::IndY,		M::None,	M::IndYW,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::Imp,	M::AbsY,	M::Imp,	M::AbsYW,M::AbsX,	M::AbsX,	M::AbsXW,M::AbsXW,//7
+	M::Imm,	M::IndX,		M::Imm,	M::IndX,		M::Zero,		M::Zero,		M::Zero,		M::Zero,		M::Imp,	M::Imm,	M::Imp,	M::Imm,	M::Abs,	M::Abs,	M::Abs,	M::Abs,	//8
+	M::Rel,	M::IndYW,	M::None,	M::IndYW,	M::ZeroX,	M::ZeroX,	M::ZeroY,	M::ZeroY,	M::Imp,	M::AbsYW,M::Imp,	M::AbsYW,M::AbsXW,M::AbsXW,M::AbsYW,M::AbsYW,//9
+	M::Imm,	M::IndX,		M::Imm,	M::IndX,		M::Zero,		M::Zero,		M::Zero,		M::Zero,		M::Imp,	M::Imm,	M::Imp,	M::Imm,	M::Abs,	M::Abs,	M::Abs,	M::Abs,	//A
+	M::Rel,	M::IndY,		M::None,	M::IndY,		M::ZeroX,	M::ZeroX,	M::ZeroY,	M::ZeroY,	M::Imp,	M::AbsY,	M::Imp,	M::AbsY,	M::AbsX,	M::AbsX,	M::AbsY,	M::AbsY,	//B
+	M::Imm,	M::IndX,		M::Imm,	M::IndX,		M::Zero,		M::Zero,		M::Zero,		M::Zero,		M::Imp,	M::Imm,	M::Imp,	M::Imm,	M::Abs,	M::Abs,	M::Abs,	M::Abs,	//C
+	M::Rel,	M::IndY,		M::None,	M::IndYW,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::Imp,	M::AbsY,	M::Imp,	M::AbsYW,M::AbsX,	M::AbsX,	M::AbsXW,M::AbsXW,//D
+	M::Imm,	M::IndX,		M::Imm,	M::IndX,		M::Zero,		M::Zero,		M::Zero,		M::Zero,		M::Imp,	M::Imm,	M::Imp,	M::Imm,	M::Abs,	M::Abs,	M::Abs,	M::Abs,	//E
+	M::Rel,	M::IndY,		M::None,	M::IndYW,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::Imp,	M::AbsY,	M::Imp,	M::AbsYW,M::AbsX,	M::AbsX,	M::AbsXW,M::AbsXW,//F
+};
+
 NesCpu::NesCpu(NesConsole* console)
 {
 	_emu = console->GetEmulator();
 	_console = console;
 	_memoryManager = _console->GetMemoryManager();
 
-	Func opTable[] = { 
-	//	0					1					2					3					4					5					6							7					8					9					A							B					C							D					E							F
-		&NesCpu::BRK,	&NesCpu::ORA,	&NesCpu::HLT,	&NesCpu::SLO,	&NesCpu::NOP,	&NesCpu::ORA,	&NesCpu::ASL_Memory,	&NesCpu::SLO,	&NesCpu::PHP,	&NesCpu::ORA,	&NesCpu::ASL_Acc,		&NesCpu::AAC,	&NesCpu::NOP,			&NesCpu::ORA,	&NesCpu::ASL_Memory,	&NesCpu::SLO, //0
-		&NesCpu::BPL,	&NesCpu::ORA,	&NesCpu::HLT,	&NesCpu::SLO,	&NesCpu::NOP,	&NesCpu::ORA,	&NesCpu::ASL_Memory,	&NesCpu::SLO,	&NesCpu::CLC,	&NesCpu::ORA,	&NesCpu::NOP,			&NesCpu::SLO,	&NesCpu::NOP,			&NesCpu::ORA,	&NesCpu::ASL_Memory,	&NesCpu::SLO, //1
-		&NesCpu::JSR,	&NesCpu::AND,	&NesCpu::HLT,	&NesCpu::RLA,	&NesCpu::BIT,	&NesCpu::AND,	&NesCpu::ROL_Memory,	&NesCpu::RLA,	&NesCpu::PLP,	&NesCpu::AND,	&NesCpu::ROL_Acc,		&NesCpu::AAC,	&NesCpu::BIT,			&NesCpu::AND,	&NesCpu::ROL_Memory,	&NesCpu::RLA, //2
-		&NesCpu::BMI,	&NesCpu::AND,	&NesCpu::HLT,	&NesCpu::RLA,	&NesCpu::NOP,	&NesCpu::AND,	&NesCpu::ROL_Memory,	&NesCpu::RLA,	&NesCpu::SEC,	&NesCpu::AND,	&NesCpu::NOP,			&NesCpu::RLA,	&NesCpu::NOP,			&NesCpu::AND,	&NesCpu::ROL_Memory,	&NesCpu::RLA, //3
-		&NesCpu::RTI,	&NesCpu::EOR,	&NesCpu::HLT,	&NesCpu::SRE,	&NesCpu::NOP,	&NesCpu::EOR,	&NesCpu::LSR_Memory,	&NesCpu::SRE,	&NesCpu::PHA,	&NesCpu::EOR,	&NesCpu::LSR_Acc,		&NesCpu::ASR,	&NesCpu::JMP_Abs,		&NesCpu::EOR,	&NesCpu::LSR_Memory,	&NesCpu::SRE, //4
-		&NesCpu::BVC,	&NesCpu::EOR,	&NesCpu::HLT,	&NesCpu::SRE,	&NesCpu::NOP,	&NesCpu::EOR,	&NesCpu::LSR_Memory,	&NesCpu::SRE,	&NesCpu::CLI,	&NesCpu::EOR,	&NesCpu::NOP,			&NesCpu::SRE,	&NesCpu::NOP,			&NesCpu::EOR,	&NesCpu::LSR_Memory,	&NesCpu::SRE, //5
-		&NesCpu::RTS,	&NesCpu::ADC,	&NesCpu::HLT,	&NesCpu::RRA,	&NesCpu::NOP,	&NesCpu::ADC,	&NesCpu::ROR_Memory,	&NesCpu::RRA,	&NesCpu::PLA,	&NesCpu::ADC,	&NesCpu::ROR_Acc,		&NesCpu::ARR,	&NesCpu::JMP_Ind,		&NesCpu::ADC,	&NesCpu::ROR_Memory,	&NesCpu::RRA, //6
-		&NesCpu::BVS,	&NesCpu::ADC,	&NesCpu::HLT,	&NesCpu::RRA,	&NesCpu::NOP,	&NesCpu::ADC,	&NesCpu::ROR_Memory,	&NesCpu::RRA,	&NesCpu::SEI,	&NesCpu::ADC,	&NesCpu::NOP,			&NesCpu::RRA,	&NesCpu::NOP,			&NesCpu::ADC,	&NesCpu::ROR_Memory,	&NesCpu::RRA, //7
-		&NesCpu::NOP,	&NesCpu::STA,	&NesCpu::NOP,	&NesCpu::SAX,	&NesCpu::STY,	&NesCpu::STA,	&NesCpu::STX,			&NesCpu::SAX,	&NesCpu::DEY,	&NesCpu::NOP,	&NesCpu::TXA,			&NesCpu::UNK,	&NesCpu::STY,			&NesCpu::STA,	&NesCpu::STX,			&NesCpu::SAX, //8
-		&NesCpu::BCC,	&NesCpu::STA,	&NesCpu::HLT,	&NesCpu::AXA,	&NesCpu::STY,	&NesCpu::STA,	&NesCpu::STX,			&NesCpu::SAX,	&NesCpu::TYA,	&NesCpu::STA,	&NesCpu::TXS,			&NesCpu::TAS,	&NesCpu::SYA,			&NesCpu::STA,	&NesCpu::SXA,			&NesCpu::AXA, //9
-		&NesCpu::LDY,	&NesCpu::LDA,	&NesCpu::LDX,	&NesCpu::LAX,	&NesCpu::LDY,	&NesCpu::LDA,	&NesCpu::LDX,			&NesCpu::LAX,	&NesCpu::TAY,	&NesCpu::LDA,	&NesCpu::TAX,			&NesCpu::ATX,	&NesCpu::LDY,			&NesCpu::LDA,	&NesCpu::LDX,			&NesCpu::LAX, //A
-		&NesCpu::BCS,	&NesCpu::LDA,	&NesCpu::HLT,	&NesCpu::LAX,	&NesCpu::LDY,	&NesCpu::LDA,	&NesCpu::LDX,			&NesCpu::LAX,	&NesCpu::CLV,	&NesCpu::LDA,	&NesCpu::TSX,			&NesCpu::LAS,	&NesCpu::LDY,			&NesCpu::LDA,	&NesCpu::LDX,			&NesCpu::LAX, //B
-		&NesCpu::CPY,	&NesCpu::CPA,	&NesCpu::NOP,	&NesCpu::DCP,	&NesCpu::CPY,	&NesCpu::CPA,	&NesCpu::DEC,			&NesCpu::DCP,	&NesCpu::INY,	&NesCpu::CPA,	&NesCpu::DEX,			&NesCpu::AXS,	&NesCpu::CPY,			&NesCpu::CPA,	&NesCpu::DEC,			&NesCpu::DCP, //C
-		&NesCpu::BNE,	&NesCpu::CPA,	&NesCpu::HLT,	&NesCpu::DCP,	&NesCpu::NOP,	&NesCpu::CPA,	&NesCpu::DEC,			&NesCpu::DCP,	&NesCpu::CLD,	&NesCpu::CPA,	&NesCpu::NOP,			&NesCpu::DCP,	&NesCpu::NOP,			&NesCpu::CPA,	&NesCpu::DEC,			&NesCpu::DCP, //D
-		&NesCpu::CPX,	&NesCpu::SBC,	&NesCpu::NOP,	&NesCpu::ISB,	&NesCpu::CPX,	&NesCpu::SBC,	&NesCpu::INC,			&NesCpu::ISB,	&NesCpu::INX,	&NesCpu::SBC,	&NesCpu::NOP,			&NesCpu::SBC,	&NesCpu::CPX,			&NesCpu::SBC,	&NesCpu::INC,			&NesCpu::ISB, //E
-		&NesCpu::BEQ,	&NesCpu::SBC,	&NesCpu::HLT,	&NesCpu::ISB,	&NesCpu::NOP,	&NesCpu::SBC,	&NesCpu::INC,			&NesCpu::ISB,	&NesCpu::SED,	&NesCpu::SBC,	&NesCpu::NOP,			&NesCpu::ISB,	&NesCpu::NOP,			&NesCpu::SBC,	&NesCpu::INC,			&NesCpu::ISB  //F
-	};
-
-	typedef NesAddrMode M;
-	NesAddrMode addrMode[] = {
-	//	0			1				2			3				4				5				6				7				8			9			A			B			C			D			E			F
-		M::Imp,	M::IndX,		M::None,	M::IndX,		M::Zero,		M::Zero,		M::Zero,		M::Zero,		M::Imp,	M::Imm,	M::Acc,	M::Imm,	M::Abs,	M::Abs,	M::Abs,	M::Abs,	//0
-		M::Rel,	M::IndY,		M::None,	M::IndYW,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::Imp,	M::AbsY,	M::Imp,	M::AbsYW,M::AbsX,	M::AbsX,	M::AbsXW,M::AbsXW,//1
-		M::Abs,	M::IndX,		M::None,	M::IndX,		M::Zero,		M::Zero,		M::Zero,		M::Zero,		M::Imp,	M::Imm,	M::Acc,	M::Imm,	M::Abs,	M::Abs,	M::Abs,	M::Abs,	//2
-		M::Rel,	M::IndY,		M::None,	M::IndYW,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::Imp,	M::AbsY,	M::Imp,	M::AbsYW,M::AbsX,	M::AbsX,	M::AbsXW,M::AbsXW,//3
-		M::Imp,	M::IndX,		M::None,	M::IndX,		M::Zero,		M::Zero,		M::Zero,		M::Zero,		M::Imp,	M::Imm,	M::Acc,	M::Imm,	M::Abs,	M::Abs,	M::Abs,	M::Abs,	//4
-		M::Rel,	M::IndY,		M::None,	M::IndYW,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::Imp,	M::AbsY,	M::Imp,	M::AbsYW,M::AbsX,	M::AbsX,	M::AbsXW,M::AbsXW,//5
-		M::Imp,	M::IndX,		M::None,	M::IndX,		M::Zero,		M::Zero,		M::Zero,		M::Zero,		M::Imp,	M::Imm,	M::Acc,	M::Imm,	M::Ind,	M::Abs,	M::Abs,	M::Abs,	//6
-		M::Rel,	M::IndY,		M::None,	M::IndYW,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::Imp,	M::AbsY,	M::Imp,	M::AbsYW,M::AbsX,	M::AbsX,	M::AbsXW,M::AbsXW,//7
-		M::Imm,	M::IndX,		M::Imm,	M::IndX,		M::Zero,		M::Zero,		M::Zero,		M::Zero,		M::Imp,	M::Imm,	M::Imp,	M::Imm,	M::Abs,	M::Abs,	M::Abs,	M::Abs,	//8
-		M::Rel,	M::IndYW,	M::None,	M::IndYW,	M::ZeroX,	M::ZeroX,	M::ZeroY,	M::ZeroY,	M::Imp,	M::AbsYW,M::Imp,	M::AbsYW,M::AbsXW,M::AbsXW,M::AbsYW,M::AbsYW,//9
-		M::Imm,	M::IndX,		M::Imm,	M::IndX,		M::Zero,		M::Zero,		M::Zero,		M::Zero,		M::Imp,	M::Imm,	M::Imp,	M::Imm,	M::Abs,	M::Abs,	M::Abs,	M::Abs,	//A
-		M::Rel,	M::IndY,		M::None,	M::IndY,		M::ZeroX,	M::ZeroX,	M::ZeroY,	M::ZeroY,	M::Imp,	M::AbsY,	M::Imp,	M::AbsY,	M::AbsX,	M::AbsX,	M::AbsY,	M::AbsY,	//B
-		M::Imm,	M::IndX,		M::Imm,	M::IndX,		M::Zero,		M::Zero,		M::Zero,		M::Zero,		M::Imp,	M::Imm,	M::Imp,	M::Imm,	M::Abs,	M::Abs,	M::Abs,	M::Abs,	//C
-		M::Rel,	M::IndY,		M::None,	M::IndYW,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::Imp,	M::AbsY,	M::Imp,	M::AbsYW,M::AbsX,	M::AbsX,	M::AbsXW,M::AbsXW,//D
-		M::Imm,	M::IndX,		M::Imm,	M::IndX,		M::Zero,		M::Zero,		M::Zero,		M::Zero,		M::Imp,	M::Imm,	M::Imp,	M::Imm,	M::Abs,	M::Abs,	M::Abs,	M::Abs,	//E
-		M::Rel,	M::IndY,		M::None,	M::IndYW,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::ZeroX,	M::Imp,	M::AbsY,	M::Imp,	M::AbsYW,M::AbsX,	M::AbsX,	M::AbsXW,M::AbsXW,//F
-	};
-	
-	memcpy(_opTable, opTable, sizeof(opTable));
-	memcpy(_addrMode, addrMode, sizeof(addrMode));
-
 	_instAddrMode = NesAddrMode::None;
 	_state = {};
 	_operand = 0;
@@ -232,6 +230,10 @@ void NesCpu::BRK() {
 void NesCpu::MemoryWrite(uint16_t addr, uint8_t value, MemoryOperationType operationType)
 {
 #ifdef DUMMYCPU
+	if(_testBus) {
+		_testBus->Write(addr, value, operationType);
+		return;
+	}
 	LogMemoryOperation(addr, value, operationType);
 #else
 	_cpuWrite = true;
@@ -245,6 +247,9 @@ void NesCpu::MemoryWrite(uint16_t addr, uint8_t value, MemoryOperationType opera
 uint8_t NesCpu::MemoryRead(uint16_t addr, MemoryOperationType operationType)
 {
 #ifdef DUMMYCPU
+	if(_testBus) {
+		return _testBus->Read(addr, operationType);
+	}
 	uint8_t value = _memoryManager->DebugRead(addr);
 	LogMemoryOperation(addr, value, operationType);
 	return value;
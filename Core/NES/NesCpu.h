@@ -1,8 +1,8 @@
-#if (defined(DUMMYCPU) && !defined(__DUMMYCPU__H)) || (!defined(DUMMYCPU) && !defined(__CPU__H))
+#if (defined(DUMMYCPU) && !defined(__DUMMYNESCPU__H)) || (!defined(DUMMYCPU) && !defined(__NESCPU__H))
 #ifdef DUMMYCPU
-#define __DUMMYCPU__H
+#define __DUMMYNESCPU__H
 #else
-#define __CPU__H
+#define __NESCPU__H
 #endif
 
 #include "pch.h"
@@ -15,6 +15,7 @@ class NesConsole;
 class NesMemoryManager;
 class DummyNesCpu;
 class Emulator;
+struct CpuTestBus;
 
 class NesCpu : public ISerializable
 {
@@ -32,8 +33,8 @@ private:
 	uint8_t _endClockCount;
 	uint16_t _operand;
 
-	Func _opTable[256];
-	NesAddrMode _addrMode[256];
+	static Func const _opTable[256];
+	static NesAddrMode const _addrMode[256];
 	NesAddrMode _instAddrMode;
 
 	bool _needHalt = false;
@@ -812,9 +813,12 @@ public:
 private:
 	uint32_t _memOpCounter = 0;
 	MemoryOperationInfo _memOperations[10] = {};
+	CpuTestBus* _testBus = nullptr;
 
 public:
 	void SetDummyState(NesCpu* c);
+	void SetDummyState(NesCpuState& state);
+	void SetTestBus(CpuTestBus* testBus) { _testBus = testBus; }
 	uint32_t GetOperationCount();
 	void LogMemoryOperation(uint32_t addr, uint8_t value, MemoryOperationType type);
 	MemoryOperationInfo GetOperationInfo(uint32_t index);
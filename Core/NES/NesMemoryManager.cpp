@@ -118,10 +118,13 @@ uint16_t NesMemoryManager::DebugReadWord(uint16_t addr)
 uint8_t NesMemoryManager::Read(uint16_t addr, MemoryOperationType operationType)
 {
 	uint8_t value = _ramReadHandlers[addr]->ReadRam(addr);
-	if(_cheatManager->HasCheats<CpuType::Nes>()) {
-		_cheatManager->ApplyCheat<CpuType::Nes>(addr, value);
+	uint8_t instrumentation = _emu->GetInstrumentation();
+	if(instrumentation) {
+		if(instrumentation & InstrumentationFlags::Cheats) {
+			_cheatManager->ApplyCheat<CpuType::Nes>(addr, value);
+		}
+		_emu->ProcessMemoryRead<CpuType::Nes>(instrumentation, addr, value, operationType);
 	}
-	_emu->ProcessMemoryRead<CpuType::Nes>(addr, value, operationType);
 
 	_openBusHandler.SetOpenBus(value);
 
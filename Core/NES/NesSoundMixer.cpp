@@ -18,6 +18,7 @@ NesSoundMixer::NesSoundMixer(NesConsole* console)
 	_blipBufLeft = blip_new(NesSoundMixer::MaxSamplesPerFrame);
 	_blipBufRight = blip_new(NesSoundMixer::MaxSamplesPerFrame);
 	_sampleRate = 96000;
+	_events.reserve(4096);
 }
 
 NesSoundMixer::~NesSoundMixer()
@@ -53,14 +54,14 @@ void NesSoundMixer::Reset()
 	blip_clear(_blipBufLeft);
 	blip_clear(_blipBufRight);
 
-	_timestamps.clear();
+	_events.clear();
 
 	for(uint32_t i = 0; i < MaxChannelCount; i++) {
 		_volumes[i] = 1.0;
 		_panning[i] = 0;
 	}
-	memset(_channelOutput, 0, sizeof(_channelOutput));
 	memset(_currentOutput, 0, sizeof(_currentOutput));
+	memset(_mixedOutput, 0, sizeof(_mixedOutput));
 
 	UpdateRates(true);
 }
@@ -174,50 +175,75 @@ double NesSoundMixer::GetChannelOutput(AudioChannel channel, bool forRightChanne
 	}
 }
 
-int16_t NesSoundMixer::GetOutputVolume(bool forRightChannel)
+int16_t NesSoundMixer::GetOutputVolume(bool forRightChannel, uint32_t changedChannels)
 {
-	double squareOutput = GetChannelOutput(AudioChannel::Square1, forRightChannel) + GetChannelOutput(AudioChannel::Square2, forRightChannel);
-	double tndOutput = GetChannelOutput(AudioChannel::DMC, forRightChannel) + 2.7516713261 * GetChannelOutput(AudioChannel::Triangle, forRightChannel) + 1.8493587125 * GetChannelOutput(AudioChannel::Noise, forRightChannel);
-
-	uint16_t squareVolume = (uint16_t)((95.88*5000.0) / (8128.0 / squareOutput + 100.0));
-	uint16_t tndVolume = (uint16_t)((159.79*5000.0) / (22638.0 / tndOutput + 100.0));
-
-	return (int16_t)(squareVolume + tndVolume +
-		GetChannelOutput(AudioChannel::FDS, forRightChannel) * 20 +
-		GetChannelOutput(AudioChannel::MMC5, forRightChannel) * 43 +
-		GetChannelOutput(AudioChannel::Namco163, forRightChannel) * 20 +
-		GetChannelOutput(AudioChannel::Sunsoft5B, forRightChannel) * 15 +
-		GetChannelOutput(AudioChannel::VRC6, forRightChannel) * 75 +
-		GetChannelOutput(AudioChannel::VRC7, forRightChannel));
+	MixerOutput& output = _mixedOutput[forRightChannel ? 1 : 0];
+
+	if(changedChannels & SquareChannelMask) {
+		double squareOutput = GetChannelOutput(AudioChannel::Square1, forRightChannel) + GetChannelOutput(AudioChannel::Square2, forRightChannel);
+		output.SquareVolume = (uint16_t)((95.88*5000.0) / (8128.0 / squareOutput + 100.0));
+	}
+
+	if(changedChannels & TndChannelMask) {
+		double tndOutput = GetChannelOutput(AudioChannel::DMC, forRightChannel) + 2.7516713261 * GetChannelOutput(AudioChannel::Triangle, forRightChannel) + 1.8493587125 * GetChannelOutput(AudioChannel::Noise, forRightChannel);
+		output.TndVolume = (uint16_t)((159.79*5000.0) / (22638.0 / tndOutput + 100.0));
+	}
+
+	if(changedChannels & ExpansionChannelMask) {
+		output.ExpansionVolume =
+			GetChannelOutput(AudioChannel::FDS, forRightChannel) * 20 +
+			GetChannelOutput(AudioChannel::MMC5, forRightChannel) * 43 +
+			GetChannelOutput(AudioChannel::Namco163, forRightChannel) * 20 +
+			GetChannelOutput(AudioChannel::Sunsoft5B, forRightChannel) * 15 +
+			GetChannelOutput(AudioChannel::VRC6, forRightChannel) * 75 +
+			GetChannelOutput(AudioChannel::VRC7, forRightChannel);
+	}
+
+	return (int16_t)(output.SquareVolume + output.TndVolume + output.ExpansionVolume);
 }
+
 void NesSoundMixer::AddDelta(AudioChannel channel, uint32_t time, int16_t delta)
 {
 	if(delta != 0) {
-		_timestamps.push_back(time);
-		_channelOutput[(int)channel][time] += delta;
+		_events.push_back({ time, (uint8_t)channel, delta });
 	}
 }
 
 void NesSoundMixer::EndFrame(uint32_t time)
 {
-	sort(_timestamps.begin(), _timestamps.end());
-	_timestamps.erase(std::unique(_timestamps.begin(), _timestamps.end()), _timestamps.end());
+	//Each channel's events are already in order, but the APU/expansion chips are run one after the other,
+	//so the events need to be merged by time. The sort is stable to keep the order of a channel's events intact.
+	if(!std::is_sorted(_events.begin(), _events.end(), [](const AudioEvent& a, const AudioEvent& b) { return a.Time < b.Time; })) {
+		std::stable_sort(_events.begin(), _events.end(), [](const AudioEvent& a, const AudioEvent& b) { return a.Time < b.Time; });
+	}
 
-	for(size_t i = 0, len = _timestamps.size(); i < len; i++) {
-		uint32_t stamp = _timestamps[i];
-		for(uint32_t j = 0; j < MaxChannelCount; j++) {
-			_currentOutput[j] += _channelOutput[j][stamp];
-		}
+	//Volumes/panning may have changed since the last frame, recalculate everything on the first update
+	uint32_t changedChannels = (1 << MaxChannelCount) - 1;
 
-		int16_t currentOutput = GetOutputVolume(false) * 4;
+	size_t len = _events.size();
+	size_t i = 0;
+	while(i < len) {
+		uint32_t stamp = _events[i].Time;
+
+		//Apply all the changes that occurred on this cycle before calculating the new output
+		do {
+			AudioEvent& evt = _events[i];
+			_currentOutput[evt.Channel] += evt.Delta;
+			changedChannels |= 1 << evt.Channel;
+			i++;
+		} while(i < len && _events[i].Time == stamp);
+
+		int16_t currentOutput = GetOutputVolume(false, changedChannels) * 4;
 		blip_add_delta(_blipBufLeft, stamp, (int)(currentOutput - _previousOutputLeft));
 		_previousOutputLeft = currentOutput;
 
 		if(_hasPanning) {
-			currentOutput = GetOutputVolume(true) * 4;
+			currentOutput = GetOutputVolume(true, changedChannels) * 4;
 			blip_add_delta(_blipBufRight, stamp, (int)(currentOutput - _previousOutputRight));
 			_previousOutputRight = currentOutput;
 		}
+
+		changedChannels = 0;
 	}
 
 	blip_end_frame(_blipBufLeft, time);
@@ -225,8 +251,6 @@ void NesSoundMixer::EndFrame(uint32_t time)
 		blip_end_frame(_blipBufRight, time);
 	}
 
-	//Reset everything
-	_timestamps.clear();
-	memset(_channelOutput, 0, sizeof(_channelOutput));
+	_events.clear();
 }
 
@@ -23,6 +23,24 @@ private:
 	static constexpr uint32_t MaxSamplesPerFrame = MaxSampleRate / 60 * 4 * 2; //x4 to allow CPU overclocking up to 10x, x2 for panning stereo
 	static constexpr uint32_t MaxChannelCount = 11;
 
+	static constexpr uint32_t SquareChannelMask = (1 << (int)AudioChannel::Square1) | (1 << (int)AudioChannel::Square2);
+	static constexpr uint32_t TndChannelMask = (1 << (int)AudioChannel::Triangle) | (1 << (int)AudioChannel::Noise) | (1 << (int)AudioChannel::DMC);
+	static constexpr uint32_t ExpansionChannelMask = ((1 << MaxChannelCount) - 1) & ~(SquareChannelMask | TndChannelMask);
+
+	struct AudioEvent
+	{
+		uint32_t Time;
+		uint8_t Channel;
+		int16_t Delta;
+	};
+
+	struct MixerOutput
+	{
+		uint16_t SquareVolume;
+		uint16_t TndVolume;
+		double ExpansionVolume;
+	};
+
 	NesConsole* _console = nullptr;
 	SoundMixer* _mixer = nullptr;
 
@@ -33,10 +51,13 @@ private:
 	int16_t _previousOutputLeft = 0;
 	int16_t _previousOutputRight = 0;
 
-	vector<uint32_t> _timestamps;
-	int16_t _channelOutput[MaxChannelCount][CycleLength] = {};
+	//Channel output changes for the current frame, in the order they were received (sorted by time in EndFrame)
+	vector<AudioEvent> _events;
 	int16_t _currentOutput[MaxChannelCount] = {};
 
+	//Mixed output of each group of channels, only recalculated when one of the group's channels changes
+	MixerOutput _mixedOutput[2] = {};
+
 	blip_t* _blipBufLeft = nullptr;
 	blip_t* _blipBufRight = nullptr;
 	int16_t* _outputBuffer = nullptr;
@@ -50,7 +71,7 @@ private:
 	bool _hasPanning = false;
 
 	__forceinline double GetChannelOutput(AudioChannel channel, bool forRightChannel);
-	__forceinline int16_t GetOutputVolume(bool forRightChannel);
+	__forceinline int16_t GetOutputVolume(bool forRightChannel, uint32_t changedChannels);
 	void EndFrame(uint32_t time);
 
 	void ProcessVsDualSystemAudio();
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "PCE/Debugger/DummyPceCpu.h"
+#include "Debugger/CpuTestBus.h"
 
 #define DUMMYCPU
 #define PceCpu DummyPceCpu
@@ -16,6 +17,10 @@ DummyPceCpu::DummyPceCpu(Emulator* emu, PceMemoryManager* memoryManager)
 
 uint8_t DummyPceCpu::MemoryRead(uint16_t addr, MemoryOperationType type)
 {
+	if(_testBus) {
+		return _testBus->Read(addr, type);
+	}
+
 	uint8_t value = _memoryManager->DebugRead(addr);
 	LogMemoryOperation(addr, value, type);
 	return value;
@@ -23,6 +28,11 @@ uint8_t DummyPceCpu::MemoryRead(uint16_t addr, MemoryOperationType type)
 
 void DummyPceCpu::MemoryWrite(uint16_t addr, uint8_t value, MemoryOperationType type)
 {
+	if(_testBus) {
+		_testBus->Write(addr, value, type);
+		return;
+	}
+
 	LogMemoryOperation(addr, value, type);
 }
 
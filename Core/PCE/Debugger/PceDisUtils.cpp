@@ -76,7 +76,7 @@ void PceDisUtils::GetDisassembly(DisassemblyInfo& info, string& out, uint32_t me
 
 	auto writeLabelOrAddr = [&str, &info, labelManager](uint16_t addr) {
 		AddressInfo address { addr, MemoryType::PceMemory };
-		string label = labelManager ? labelManager->GetLabel(address, !info.IsJump()) : "";
+		string_view label = labelManager ? labelManager->GetLabelView(address, !info.IsJump()) : string_view();
 		if(label.empty()) {
 			str.WriteAll('$', HexUtilities::ToHex(addr));
 		} else {
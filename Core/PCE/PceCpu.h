@@ -1,8 +1,8 @@
-#if (defined(DUMMYCPU) && !defined(__DUMMYCPU__H)) || (!defined(DUMMYCPU) && !defined(__CPU__H))
+#if (defined(DUMMYCPU) && !defined(__DUMMYPCECPU__H)) || (!defined(DUMMYCPU) && !defined(__PCECPU__H))
 #ifdef DUMMYCPU
-#define __DUMMYCPU__H
+#define __DUMMYPCECPU__H
 #else
-#define __CPU__H
+#define __PCECPU__H
 #endif
 
 #include "pch.h"
@@ -12,6 +12,7 @@
 
 class Emulator;
 class PceMemoryManager;
+struct CpuTestBus;
 
 class PceCpu final : public ISerializable
 {
@@ -305,11 +306,13 @@ public:
 private:
 	uint32_t _memOpCounter = 0;
 	MemoryOperationInfo _memOperations[10] = {};
+	CpuTestBus* _testBus = nullptr;
 
 	void LogMemoryOperation(uint32_t addr, uint8_t value, MemoryOperationType type);
 
 public:
 	void SetDummyState(PceCpuState& state);
+	void SetTestBus(CpuTestBus* testBus) { _testBus = testBus; }
 
 	uint32_t GetOperationCount();
 	MemoryOperationInfo GetOperationInfo(uint32_t index);
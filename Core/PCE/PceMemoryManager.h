@@ -113,10 +113,13 @@ __forceinline uint8_t PceMemoryManager::Read(uint16_t addr, MemoryOperationType
 		value = _mapper->Read(bank, addr, value);
 	}
 
-	if(_cheatManager->HasCheats<CpuType::Pce>()) {
-		_cheatManager->ApplyCheat<CpuType::Pce>((bank << 13) | (addr & 0x1FFF), value);
+	uint8_t instrumentation = _emu->GetInstrumentation();
+	if(instrumentation) {
+		if(instrumentation & InstrumentationFlags::Cheats) {
+			_cheatManager->ApplyCheat<CpuType::Pce>((bank << 13) | (addr & 0x1FFF), value);
+		}
+		_emu->ProcessMemoryRead<CpuType::Pce>(instrumentation, addr, value, type);
 	}
-	_emu->ProcessMemoryRead<CpuType::Pce>(addr, value, type);
 	return value;
 }
 
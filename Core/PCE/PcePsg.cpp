@@ -33,6 +33,7 @@ PcePsg::PcePsg(Emulator* emu, PceConsole* console)
 
 PcePsg::~PcePsg()
 {
+	StopWorkerThread();
 	blip_delete(_leftChannel);
 	blip_delete(_rightChannel);
 	delete[] _soundBuffer;
@@ -60,8 +61,18 @@ uint32_t PcePsg::GetLfoCh1PeriodOffset()
 
 void PcePsg::Write(uint16_t addr, uint8_t value)
 {
-	Run();
+	if(_useWorkerThread) {
+		//The PSG's registers can't be read, so the emulation never depends on its state and the writes can be processed later
+		_pendingWrites.push_back({ _console->GetMasterClock(), addr, value });
+		return;
+	}
+
+	RunUntil(_console->GetMasterClock());
+	ApplyWrite(addr, value);
+}
 
+void PcePsg::ApplyWrite(uint16_t addr, uint8_t value)
+{
 	switch(addr & 0x0F) {
 		case 0: _state.ChannelSelect = value & 0x07; break;
 		case 1:
@@ -91,7 +102,30 @@ void PcePsg::Write(uint16_t addr, uint8_t value)
 
 void PcePsg::Run()
 {
-	uint64_t clock = _console->GetMasterClock();
+	//Called at the end of each frame
+	if(_useWorkerThread) {
+		WaitForWorker();
+		PlayPendingAudio();
+	}
+
+	bool useWorkerThread = _emu->GetSettings()->GetPcEngineConfig().RunPsgOnSeparateThread && !_emu->IsDebugging();
+	if(_useWorkerThread) {
+		if(useWorkerThread) {
+			StartJob(_console->GetMasterClock());
+			return;
+		}
+
+		//Go back to processing writes as they occur (the replayed writes' audio must be sent to the mixer directly)
+		_useWorkerThread = false;
+		ReplayWrites(_pendingWrites);
+	}
+
+	RunUntil(_console->GetMasterClock());
+	_useWorkerThread = useWorkerThread;
+}
+
+void PcePsg::RunUntil(uint64_t clock)
+{
 	uint32_t clocksToRun = clock - _lastClock;
 	PcEngineConfig& cfg = _emu->GetSettings()->GetPcEngineConfig();
 	while(clocksToRun >= 6) {
@@ -132,15 +166,103 @@ void PcePsg::Run()
 
 		uint32_t sampleCount = (uint32_t)blip_read_samples(_leftChannel, _soundBuffer, PcePsg::MaxSamples, 1);
 		blip_read_samples(_rightChannel, _soundBuffer + 1, PcePsg::MaxSamples, 1);
-		_soundMixer->PlayAudioBuffer(_soundBuffer, sampleCount, PcePsg::SampleRate);
+		if(_useWorkerThread) {
+			_pendingAudio.insert(_pendingAudio.end(), _soundBuffer, _soundBuffer + sampleCount * 2);
+			_pendingAudioChunks.push_back(sampleCount);
+		} else {
+			_soundMixer->PlayAudioBuffer(_soundBuffer, sampleCount, PcePsg::SampleRate);
+		}
 		_clockCounter = 0;
 	}
 
 	_lastClock = clock - clocksToRun;
 }
 
+void PcePsg::ReplayWrites(vector<PsgWrite>& writes)
+{
+	for(PsgWrite& write : writes) {
+		RunUntil(write.Clock);
+		ApplyWrite(write.Addr, write.Value);
+	}
+	writes.clear();
+}
+
+void PcePsg::StartJob(uint64_t endClock)
+{
+	if(!_workerThread.joinable()) {
+		_workerThread = std::thread([this]() { WorkerThread(); });
+	}
+
+	std::unique_lock<std::mutex> lock(_workerLock);
+	_jobWrites.swap(_pendingWrites);
+	_jobEndClock = endClock;
+	_jobPending = true;
+	_workerSignal.notify_all();
+}
+
+void PcePsg::WaitForWorker()
+{
+	if(!_workerThread.joinable()) {
+		return;
+	}
+
+	std::unique_lock<std::mutex> lock(_workerLock);
+	_workerSignal.wait(lock, [this] { return !_jobPending; });
+}
+
+void PcePsg::PlayPendingAudio()
+{
+	uint32_t offset = 0;
+	for(uint32_t sampleCount : _pendingAudioChunks) {
+		_soundMixer->PlayAudioBuffer(_pendingAudio.data() + offset, sampleCount, PcePsg::SampleRate);
+		offset += sampleCount * 2;
+	}
+	_pendingAudio.clear();
+	_pendingAudioChunks.clear();
+}
+
+void PcePsg::StopWorkerThread()
+{
+	{
+		std::unique_lock<std::mutex> lock(_workerLock);
+		_stopWorker = true;
+		_workerSignal.notify_all();
+	}
+
+	if(_workerThread.joinable()) {
+		_workerThread.join();
+	}
+}
+
+void PcePsg::WorkerThread()
+{
+	while(true) {
+		{
+			std::unique_lock<std::mutex> lock(_workerLock);
+			_workerSignal.wait(lock, [this] { return _jobPending || _stopWorker; });
+			if(_stopWorker) {
+				break;
+			}
+		}
+
+		//The emulation thread doesn't touch the PSG's state until the job is done
+		ReplayWrites(_jobWrites);
+		RunUntil(_jobEndClock);
+
+		std::unique_lock<std::mutex> lock(_workerLock);
+		_jobPending = false;
+		_workerSignal.notify_all();
+	}
+}
+
 void PcePsg::Serialize(Serializer& s)
 {
+	if(_useWorkerThread) {
+		//Bring the PSG to the state it would be in if the writes had been processed as they occurred
+		WaitForWorker();
+		ReplayWrites(_pendingWrites);
+	}
+
 	SV(_state.ChannelSelect);
 	SV(_state.LeftVolume);
 	SV(_state.LfoControl);
@@ -158,4 +280,9 @@ void PcePsg::Serialize(Serializer& s)
 	for(int i = 0; i < 6; i++) {
 		SVI(_channels[i]);
 	}
+
+	if(!s.IsSaving()) {
+		_pendingAudio.clear();
+		_pendingAudioChunks.clear();
+	}
 }
@@ -4,6 +4,9 @@
 #include "PCE/PceTypes.h"
 #include "PCE/PcePsgChannel.h"
 #include "Utilities/ISerializable.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 class Emulator;
 class PceConsole;
@@ -32,6 +35,40 @@ private:
 
 	uint32_t _clockCounter = 0;
 
+	struct PsgWrite
+	{
+		uint64_t Clock;
+		uint16_t Addr;
+		uint8_t Value;
+	};
+
+	//When running on the worker thread, writes are recorded during the frame and replayed
+	//by the worker thread (along with the synthesis) while the next frame is being emulated
+	bool _useWorkerThread = false;
+	vector<PsgWrite> _pendingWrites;
+
+	std::thread _workerThread;
+	std::mutex _workerLock;
+	std::condition_variable _workerSignal;
+	bool _jobPending = false;
+	bool _stopWorker = false;
+	vector<PsgWrite> _jobWrites;
+	uint64_t _jobEndClock = 0;
+
+	//Audio generated by the worker thread, sent to the sound mixer by the emulation thread
+	vector<int16_t> _pendingAudio;
+	vector<uint32_t> _pendingAudioChunks;
+
+	void RunUntil(uint64_t clock);
+	void ApplyWrite(uint16_t addr, uint8_t value);
+	void ReplayWrites(vector<PsgWrite>& writes);
+
+	void StartJob(uint64_t endClock);
+	void WaitForWorker();
+	void PlayPendingAudio();
+	void StopWorkerThread();
+	void WorkerThread();
+
 public:
 	PcePsg(Emulator* emu, PceConsole* console);
 	~PcePsg();
@@ -40,8 +77,10 @@ public:
 	uint16_t GetLfoFrequency();
 	uint32_t GetLfoCh1PeriodOffset();
 
-	PcePsgState& GetState() { return _state; }
-	PcePsgChannelState& GetChannelState(uint8_t ch) { return _channels[ch].GetState(); }
+	//Only waits for the worker thread: the writes recorded during the current frame are not applied until the end of the frame.
+	//The worker thread is never used while debugging, so this only affects the frame during which the debugger is attached.
+	PcePsgState& GetState() { WaitForWorker(); return _state; }
+	PcePsgChannelState& GetChannelState(uint8_t ch) { WaitForWorker(); return _channels[ch].GetState(); }
 
 	void Write(uint16_t addr, uint8_t value);
 	void Run();
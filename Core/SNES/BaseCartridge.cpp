@@ -369,6 +369,11 @@ void BaseCartridge::LoadBattery()
 
 void BaseCartridge::SaveBattery()
 {
+	if(_coprocessor) {
+		//Coprocessors running on another thread can still be writing to their battery-backed memory
+		_coprocessor->SyncThread();
+	}
+
 	if(_saveRamSize > 0) {
 		_emu->GetBatteryManager()->SaveBattery(".srm", _saveRam, _saveRamSize);
 	} 
@@ -498,8 +503,10 @@ void BaseCartridge::InitCoprocessor()
 		_needCoprocSync = true;
 	} else if(_coprocessorType == CoprocessorType::SDD1) {
 		_coprocessor.reset(new Sdd1(_console));
+		_sdd1 = dynamic_cast<Sdd1*>(_coprocessor.get());
 	} else if(_coprocessorType == CoprocessorType::SPC7110) {
 		_coprocessor.reset(new Spc7110(_console, _hasRtc));
+		_spc7110 = dynamic_cast<Spc7110*>(_coprocessor.get());
 	} else if(_coprocessorType == CoprocessorType::Satellaview) {
 		//Share save file across all .bs files that use the BS-X bios
 		_emu->GetBatteryManager()->Initialize("BsxBios");
@@ -796,6 +803,16 @@ Cx4* BaseCartridge::GetCx4()
 	return _cx4;
 }
 
+Sdd1* BaseCartridge::GetSdd1()
+{
+	return _sdd1;
+}
+
+Spc7110* BaseCartridge::GetSpc7110()
+{
+	return _spc7110;
+}
+
 SuperGameboy* BaseCartridge::GetSuperGameboy()
 {
 	return _sgb;
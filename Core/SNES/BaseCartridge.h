@@ -13,6 +13,8 @@ class NecDsp;
 class Sa1;
 class Gsu;
 class Cx4;
+class Sdd1;
+class Spc7110;
 class SuperGameboy;
 class BsxCart;
 class BsxMemoryPack;
@@ -41,6 +43,8 @@ private:
 	Sa1 *_sa1 = nullptr;
 	Gsu *_gsu = nullptr;
 	Cx4 *_cx4 = nullptr;
+	Sdd1 *_sdd1 = nullptr;
+	Spc7110 *_spc7110 = nullptr;
 	SuperGameboy *_sgb = nullptr;
 	BsxCart* _bsx = nullptr;
 	unique_ptr<BsxMemoryPack> _bsxMemPack;
@@ -120,6 +124,8 @@ public:
 	Sa1* GetSa1();
 	Gsu* GetGsu();
 	Cx4* GetCx4();
+	Sdd1* GetSdd1();
+	Spc7110* GetSpc7110();
 	SuperGameboy* GetSuperGameboy();
 	BsxCart* GetBsx();
 	BsxMemoryPack* GetBsxMemoryPack();
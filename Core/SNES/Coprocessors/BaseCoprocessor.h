@@ -13,6 +13,12 @@ public:
 
 	virtual void Run() { }	
 	virtual void ProcessEndOfFrame() { }
+
+	//Used by coprocessors that can run on a separate thread - waits for the thread to catch up to the CPU
+	virtual void SyncThread() { }
+	//Called before the CPU checks its IRQ line
+	virtual void SyncIrq() { }
+
 	virtual void LoadBattery() { }
 	virtual void SaveBattery() { }
 };
\ No newline at end of file
@@ -0,0 +1,89 @@
+#include "pch.h"
+#include "SNES/Coprocessors/CoprocessorWorker.h"
+
+CoprocessorWorker::CoprocessorWorker(std::function<void(uint64_t)> runUntil)
+{
+	_runUntil = runUntil;
+	_target = 0;
+	_done = 0;
+	_active = false;
+	_sleeping = false;
+	_stopFlag = false;
+}
+
+CoprocessorWorker::~CoprocessorWorker()
+{
+	Stop();
+}
+
+void CoprocessorWorker::Start(uint64_t targetCycle)
+{
+	if(!_thread.joinable()) {
+		_thread = std::thread([this]() { WorkerThread(); });
+	}
+
+	_running = true;
+	_done.store(targetCycle, std::memory_order_relaxed);
+	_target.store(targetCycle, std::memory_order_release);
+	_active = true;
+
+	if(_sleeping) {
+		std::unique_lock<std::mutex> lock(_lock);
+		_signal.notify_one();
+	}
+}
+
+void CoprocessorWorker::Sync(uint64_t targetCycle)
+{
+	if(!_running) {
+		return;
+	}
+
+	_target.store(targetCycle, std::memory_order_release);
+	while(_done.load(std::memory_order_acquire) < targetCycle) {
+		std::this_thread::yield();
+	}
+
+	_active = false;
+	_running = false;
+}
+
+void CoprocessorWorker::Stop()
+{
+	{
+		std::unique_lock<std::mutex> lock(_lock);
+		_stopFlag = true;
+		_signal.notify_all();
+	}
+
+	if(_thread.joinable()) {
+		_thread.join();
+	}
+	_running = false;
+}
+
+void CoprocessorWorker::WorkerThread()
+{
+	while(!_stopFlag) {
+		if(!_active) {
+			//Spin for a bit before sleeping, the emulation thread usually hands the coprocessor back shortly after synchronizing
+			for(int i = 0; i < 1000 && !_active && !_stopFlag; i++) {
+				std::this_thread::yield();
+			}
+
+			std::unique_lock<std::mutex> lock(_lock);
+			_sleeping = true;
+			_signal.wait(lock, [this] { return _active || _stopFlag; });
+			_sleeping = false;
+			continue;
+		}
+
+		uint64_t targetCycle = _target.load(std::memory_order_acquire);
+		if(targetCycle > _done.load(std::memory_order_relaxed)) {
+			_runUntil(targetCycle);
+			_done.store(targetCycle, std::memory_order_release);
+		} else {
+			std::this_thread::yield();
+		}
+	}
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include "pch.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+//Runs a coprocessor on a separate thread, up to the target cycle set by the emulation thread.
+//While the worker owns the coprocessor (IsRunning), the emulation thread must call Sync() before
+//accessing any state the coprocessor can modify.
+class CoprocessorWorker
+{
+private:
+	std::function<void(uint64_t)> _runUntil;
+
+	std::thread _thread;
+	std::mutex _lock;
+	std::condition_variable _signal;
+	std::atomic<uint64_t> _target;
+	std::atomic<uint64_t> _done;
+	std::atomic<bool> _active;
+	std::atomic<bool> _sleeping;
+	std::atomic<bool> _stopFlag;
+
+	//Only accessed by the emulation thread
+	bool _running = false;
+
+	void WorkerThread();
+
+public:
+	CoprocessorWorker(std::function<void(uint64_t)> runUntil);
+	~CoprocessorWorker();
+
+	bool IsRunning() { return _running; }
+
+	//Gives ownership of the coprocessor to the worker thread, targetCycle must be the cycle the coprocessor is currently at
+	void Start(uint64_t targetCycle);
+
+	__forceinline void SetTarget(uint64_t targetCycle)
+	{
+		_target.store(targetCycle, std::memory_order_release);
+	}
+
+	//Waits for the worker to reach targetCycle and gives the coprocessor back to the emulation thread
+	void Sync(uint64_t targetCycle);
+
+	void Stop();
+};
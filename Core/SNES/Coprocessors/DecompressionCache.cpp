@@ -0,0 +1,54 @@
+#include "pch.h"
+#include "SNES/Coprocessors/DecompressionCache.h"
+
+DecompressionCacheEntry* DecompressionCache::Add(uint64_t key)
+{
+	_misses++;
+
+	auto result = _entries.find(key);
+	if(result != _entries.end()) {
+		_cacheSize -= (uint32_t)(result->second.Source.size() + result->second.Output.size());
+		_entries.erase(result);
+	}
+
+	if(_cacheSize > DecompressionCache::MaxCacheSize) {
+		RemoveOldestEntries();
+	}
+
+	DecompressionCacheEntry& entry = _entries[key];
+	entry.LastUse = ++_useCounter;
+	return &entry;
+}
+
+void DecompressionCache::RemoveOldestEntries()
+{
+	//Remove the least recently used half of the entries
+	vector<uint64_t> lastUse;
+	lastUse.reserve(_entries.size());
+	for(auto& [key, entry] : _entries) {
+		lastUse.push_back(entry.LastUse);
+	}
+
+	std::nth_element(lastUse.begin(), lastUse.begin() + lastUse.size() / 2, lastUse.end());
+	uint64_t threshold = lastUse[lastUse.size() / 2];
+
+	for(auto itr = _entries.begin(); itr != _entries.end();) {
+		if(itr->second.LastUse <= threshold) {
+			_cacheSize -= (uint32_t)(itr->second.Source.size() + itr->second.Output.size());
+			itr = _entries.erase(itr);
+		} else {
+			itr++;
+		}
+	}
+}
+
+DecompressionCacheState DecompressionCache::GetState()
+{
+	DecompressionCacheState state = {};
+	state.Hits = _hits;
+	state.Misses = _misses;
+	state.EntryCount = (uint32_t)_entries.size();
+	state.CacheSize = _cacheSize;
+	state.MaxCacheSize = DecompressionCache::MaxCacheSize;
+	return state;
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include "pch.h"
+
+struct DecompressionCacheState
+{
+	uint64_t Hits;
+	uint64_t Misses;
+	uint32_t EntryCount;
+	uint32_t CacheSize;
+	uint32_t MaxCacheSize;
+};
+
+struct DecompressionCacheEntry
+{
+	//Compressed data read by the decompressor, used to make sure the ROM still contains the same data before reusing the output
+	vector<uint8_t> Source;
+	vector<uint8_t> Output;
+	uint64_t LastUse = 0;
+};
+
+//Bounded (LRU) cache of the output of the S-DD1/SPC7110 decompressors, keyed by decompression mode and source address.
+//Games tend to decompress the same streams over and over again, and decoding them is expensive (bit by bit).
+class DecompressionCache
+{
+private:
+	static constexpr uint32_t MaxCacheSize = 0x400000;
+	//Streams longer than this are only partially cached
+	static constexpr uint32_t MaxStreamSize = 0x10000;
+
+	unordered_map<uint64_t, DecompressionCacheEntry> _entries;
+	uint32_t _cacheSize = 0;
+	uint64_t _useCounter = 0;
+	uint64_t _hits = 0;
+	uint64_t _misses = 0;
+
+	void RemoveOldestEntries();
+
+public:
+	//Returns the entry for the stream if it exists and its source data matches the ROM's current content
+	template<typename T>
+	DecompressionCacheEntry* Find(uint64_t key, uint32_t origin, T readSource)
+	{
+		auto result = _entries.find(key);
+		if(result == _entries.end() || result->second.Output.empty()) {
+			return nullptr;
+		}
+
+		DecompressionCacheEntry& entry = result->second;
+		for(size_t i = 0, len = entry.Source.size(); i < len; i++) {
+			if(readSource((uint32_t)(origin + i)) != entry.Source[i]) {
+				return nullptr;
+			}
+		}
+
+		_hits++;
+		entry.LastUse = ++_useCounter;
+		return &entry;
+	}
+
+	//Creates a new (empty) entry for a stream that is about to be decoded, replacing any existing entry for the same key
+	DecompressionCacheEntry* Add(uint64_t key);
+
+	//Appends decoded data to the entry, along with any new source data read by the decompressor.
+	//Returns false once the stream is too large to be cached any further.
+	template<typename T>
+	bool Append(DecompressionCacheEntry* entry, const uint8_t* output, uint32_t outputLength, uint32_t origin, uint32_t sourceLength, T readSource)
+	{
+		if(entry->Output.size() + outputLength > DecompressionCache::MaxStreamSize) {
+			return false;
+		}
+
+		entry->Output.insert(entry->Output.end(), output, output + outputLength);
+		_cacheSize += outputLength;
+
+		for(uint32_t i = (uint32_t)entry->Source.size(); i < sourceLength; i++) {
+			entry->Source.push_back(readSource(origin + i));
+			_cacheSize++;
+		}
+		return true;
+	}
+
+	DecompressionCacheState GetState();
+};
@@ -7,7 +7,7 @@ void Gsu::STOP()
 {
 	if(!_state.IrqDisabled) {
 		_state.SFR.Irq = true;
-		_cpu->SetIrqSource(SnesIrqSource::Coprocessor);
+		_irqPending = true;
 	}
 	_state.ProgramReadBuffer = 0x01; //Run a NOP first when the GSU is restarted
 	_state.SFR.Running = false;
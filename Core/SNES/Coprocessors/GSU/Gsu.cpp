@@ -24,6 +24,14 @@ Gsu::Gsu(SnesConsole *console, uint32_t gsuRamSize)
 	_settings = _emu->GetSettings();
 
 	_clockMultiplier = std::max(1u, _settings->GetSnesConfig().GsuClockSpeed / 100);
+	_useWorkerThread = _settings->GetSnesConfig().RunGsuOnSeparateThread;
+	_workerIdle = false;
+	_worker.reset(new CoprocessorWorker([this](uint64_t targetCycle) {
+		RunUntil(targetCycle);
+		if(_stopped) {
+			_workerIdle.store(true, std::memory_order_relaxed);
+		}
+	}));
 
 	_state = {};
 	_state.ProgramReadBuffer = 0x01; //Run a NOP on first cycle
@@ -37,14 +45,14 @@ Gsu::Gsu(SnesConsole *console, uint32_t gsuRamSize)
 
 	for(uint32_t i = 0; i < _gsuRamSize / 0x1000; i++) {
 		_gsuRamHandlers.push_back(unique_ptr<IMemoryHandler>(new RamHandler(_gsuRam, i * 0x1000, _gsuRamSize, MemoryType::GsuWorkRam)));
-		_gsuCpuRamHandlers.push_back(unique_ptr<IMemoryHandler>(new GsuRamHandler(_state, _gsuRamHandlers.back().get())));
+		_gsuCpuRamHandlers.push_back(unique_ptr<IMemoryHandler>(new GsuRamHandler(this, _state, _gsuRamHandlers.back().get())));
 	}
 	
 	//CPU mappings
 	MemoryMappings *cpuMappings = _memoryManager->GetMemoryMappings();
 	vector<unique_ptr<IMemoryHandler>> &prgRomHandlers = _console->GetCartridge()->GetPrgRomHandlers();
 	for(unique_ptr<IMemoryHandler> &handler : prgRomHandlers) {
-		_gsuCpuRomHandlers.push_back(unique_ptr<IMemoryHandler>(new GsuRomHandler(_state, handler.get())));
+		_gsuCpuRomHandlers.push_back(unique_ptr<IMemoryHandler>(new GsuRomHandler(this, _state, handler.get())));
 	}
 
 	//GSU registers in CPU memory space
@@ -70,15 +78,21 @@ Gsu::Gsu(SnesConsole *console, uint32_t gsuRamSize)
 
 	_mappings.RegisterHandler(0x40, 0x5F, 0x0000, 0xFFFF, prgRomHandlers);
 	_mappings.RegisterHandler(0x70, 0x71, 0x0000, 0xFFFF, _gsuRamHandlers);
+
+	_cpu->SetThreadedCoprocessor(this);
 }
 
 Gsu::~Gsu()
 {
+	_worker->Stop();
 	delete[] _gsuRam;
 }
 
 void Gsu::ProcessEndOfFrame()
 {
+	SyncThread();
+	_useWorkerThread = _settings->GetSnesConfig().RunGsuOnSeparateThread;
+
 	uint8_t clockMultiplier = std::max(1u, _settings->GetSnesConfig().GsuClockSpeed / 100);
 	if(_clockMultiplier != clockMultiplier) {
 		_state.CycleCount = (uint64_t)((double)_state.CycleCount / _clockMultiplier * clockMultiplier);
@@ -90,6 +104,31 @@ void Gsu::Run()
 {
 	uint64_t targetCycle = _memoryManager->GetMasterClock() * _clockMultiplier;
 
+	if(_worker->IsRunning()) {
+		if(!_workerIdle.load(std::memory_order_relaxed)) {
+			if(targetCycle - _workerPublishedCycle >= Gsu::WorkerSyncInterval * _clockMultiplier) {
+				_workerPublishedCycle = targetCycle;
+				_worker->SetTarget(targetCycle);
+			}
+			return;
+		}
+
+		//The GSU stopped, run it on this thread until it is restarted
+		SyncThread();
+	}
+
+	RunUntil(targetCycle);
+	ProcessPendingIrq();
+
+	if(_useWorkerThread && !_stopped && CanUseWorkerThread()) {
+		_workerPublishedCycle = targetCycle;
+		_workerIdle.store(false, std::memory_order_relaxed);
+		_worker->Start(targetCycle);
+	}
+}
+
+void Gsu::RunUntil(uint64_t targetCycle)
+{
 	while(!_stopped && _state.CycleCount < targetCycle) {
 		Exec();
 	}
@@ -99,6 +138,51 @@ void Gsu::Run()
 	}
 }
 
+void Gsu::ProcessPendingIrq()
+{
+	if(_irqPending) {
+		_irqPending = false;
+		_cpu->SetIrqSource(SnesIrqSource::Coprocessor);
+	}
+}
+
+bool Gsu::CanUseWorkerThread()
+{
+	if(_emu->IsDebugging() || _memoryManager->GetMasterClock() < _workerRestartClock) {
+		return false;
+	}
+
+	if(!_state.IrqDisabled) {
+		//The CPU has to synchronize with the GSU each time it checks its IRQ line, so only use
+		//the worker thread while the CPU ignores IRQs (otherwise it would synchronize on every cycle)
+		SnesCpuState& cpuState = _cpu->GetState();
+		return (cpuState.PS & ProcFlags::IrqDisable) && cpuState.StopState == SnesCpuStopState::Running;
+	}
+
+	return true;
+}
+
+void Gsu::SyncThread()
+{
+	if(!_worker->IsRunning()) {
+		return;
+	}
+
+	//Let the worker thread catch up to the current master clock, then take back ownership of the GSU's state.
+	//The GSU runs the exact same instructions as it would on the CPU thread, so the result is identical.
+	_worker->Sync(_memoryManager->GetMasterClock() * _clockMultiplier);
+	_workerRestartClock = _memoryManager->GetMasterClock() + Gsu::WorkerRestartDelay;
+	ProcessPendingIrq();
+}
+
+void Gsu::SyncIrq()
+{
+	//STOP can only trigger an IRQ when IRQs are enabled in CFGR (which can only be changed by the CPU)
+	if(_worker->IsRunning() && !_state.IrqDisabled) {
+		SyncThread();
+	}
+}
+
 void Gsu::Exec()
 {
 	uint8_t opCode = ReadOpCode();
@@ -449,6 +533,8 @@ void Gsu::Step(uint64_t cycles)
 
 void Gsu::Reset()
 {
+	SyncThread();
+
 	_state = {};
 	_state.ProgramReadBuffer = 0x01; //Run a NOP on first cycle
 	
@@ -457,11 +543,14 @@ void Gsu::Reset()
 	_waitForRomAccess = false;
 	_waitForRamAccess = false;
 	_stopped = true;
+	_irqPending = false;
 	_lastOpAddr = 0;
 }
 
 uint8_t Gsu::Read(uint32_t addr)
 {
+	SyncThread();
+
 	addr &= 0x33FF;
 	if(_state.SFR.Running && addr != 0x3030 && addr != 0x3031 && addr != 0x303B) {
 		//"During GSU operation, only SFR, SCMR, and VCR may be accessed."
@@ -505,6 +594,8 @@ uint8_t Gsu::Read(uint32_t addr)
 
 void Gsu::Write(uint32_t addr, uint8_t value)
 {
+	SyncThread();
+
 	addr &= 0x33FF;
 	if(_state.SFR.Running && addr != 0x3030 && addr != 0x303A) {
 		//"During GSU operation, only SFR, SCMR, and VCR may be accessed."
@@ -607,6 +698,8 @@ AddressInfo Gsu::GetAbsoluteAddress(uint32_t address)
 
 void Gsu::Serialize(Serializer &s)
 {
+	SyncThread();
+
 	SV(_state.CycleCount); SV(_state.RegisterLatch); SV(_state.ProgramBank); SV(_state.RomBank); SV(_state.RamBank); SV(_state.IrqDisabled);
 	SV(_state.HighSpeedMode); SV(_state.ClockSelect); SV(_state.BackupRamEnabled); SV(_state.ScreenBase); SV(_state.ColorGradient); SV(_state.PlotBpp);
 	SV(_state.ScreenHeight); SV(_state.GsuRamAccess); SV(_state.GsuRomAccess); SV(_state.CacheBase); SV(_state.PlotTransparent); SV(_state.PlotDither);
@@ -629,11 +722,13 @@ void Gsu::Serialize(Serializer &s)
 
 void Gsu::LoadBattery()
 {
+	SyncThread();
 	_emu->GetBatteryManager()->LoadBattery(".srm", (uint8_t*)_gsuRam, _gsuRamSize);
 }
 
 void Gsu::SaveBattery()
 {
+	SyncThread();
 	_emu->GetBatteryManager()->SaveBattery(".srm", (uint8_t*)_gsuRam, _gsuRamSize);
 }
 
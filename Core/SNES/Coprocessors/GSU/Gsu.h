@@ -4,6 +4,7 @@
 #include "SNES/Coprocessors/GSU/GsuTypes.h"
 #include "SNES/MemoryMappings.h"
 #include "SNES/IMemoryHandler.h"
+#include "SNES/Coprocessors/CoprocessorWorker.h"
 
 class Emulator;
 class SnesConsole;
@@ -36,12 +37,31 @@ private:
 	uint32_t _gsuRamSize = 0;
 	uint8_t* _gsuRam = nullptr;
 
+	//Set by STOP, the IRQ is sent to the CPU by the CPU thread (the GSU can run on a separate thread)
+	bool _irqPending = false;
+
+	//Number of master clocks between each update of the worker thread's target cycle
+	static constexpr uint64_t WorkerSyncInterval = 64;
+	//Number of master clocks to run the GSU on the CPU thread after a synchronization, before using the worker thread again
+	static constexpr uint64_t WorkerRestartDelay = 256;
+
+	//When the worker is running, the GSU's state may only be accessed by the worker thread
+	unique_ptr<CoprocessorWorker> _worker;
+	bool _useWorkerThread = false;
+	uint64_t _workerPublishedCycle = 0;
+	uint64_t _workerRestartClock = 0;
+	std::atomic<bool> _workerIdle;
+
 	MemoryMappings _mappings;
 	vector<unique_ptr<IMemoryHandler>> _gsuRamHandlers;
 	vector<unique_ptr<IMemoryHandler>> _gsuCpuRamHandlers;
 	vector<unique_ptr<IMemoryHandler>> _gsuCpuRomHandlers;
 
 	void Exec();
+	void RunUntil(uint64_t targetCycle);
+	void ProcessPendingIrq();
+
+	bool CanUseWorkerThread();
 
 	void InitProgramCache(uint16_t cacheAddr);
 
@@ -162,6 +182,9 @@ public:
 	void Run() override;
 	void Reset() override;
 
+	void SyncThread() override;
+	void SyncIrq() override;
+
 	uint8_t Read(uint32_t addr) override;
 	uint8_t Peek(uint32_t addr) override;
 	void PeekBlock(uint32_t addr, uint8_t *output) override;
@@ -2,22 +2,31 @@
 #include "pch.h"
 #include "SNES/IMemoryHandler.h"
 #include "SNES/Coprocessors/GSU/GsuTypes.h"
+#include "SNES/Coprocessors/GSU/Gsu.h"
 #include "Shared/MemoryType.h"
 
 class GsuRamHandler : public IMemoryHandler
 {
 private:
+	Gsu *_gsu;
 	GsuState *_state;
 	IMemoryHandler *_handler;
 
 public:
-	GsuRamHandler(GsuState &state, IMemoryHandler *handler) : IMemoryHandler(MemoryType::GsuWorkRam)
+	GsuRamHandler(Gsu *gsu, GsuState &state, IMemoryHandler *handler) : IMemoryHandler(MemoryType::GsuWorkRam)
 	{
+		_gsu = gsu;
 		_handler = handler;
 		_state = &state;
 	}
 
 	uint8_t Read(uint32_t addr) override
+	{
+		_gsu->SyncThread();
+		return Peek(addr);
+	}
+
+	uint8_t Peek(uint32_t addr) override
 	{
 		if(!_state->SFR.Running || !_state->GsuRamAccess) {
 			return _handler->Read(addr);
@@ -27,20 +36,16 @@ public:
 		return 0;
 	}
 
-	uint8_t Peek(uint32_t addr) override
-	{
-		return Read(addr);
-	}
-
 	void PeekBlock(uint32_t addr, uint8_t *output) override
 	{
 		for(int i = 0; i < 0x1000; i++) {
-			output[i] = Read(i);
+			output[i] = Peek(i);
 		}
 	}
 
 	void Write(uint32_t addr, uint8_t value) override
 	{
+		_gsu->SyncThread();
 		if(!_state->SFR.Running || !_state->GsuRamAccess) {
 			_handler->Write(addr, value);
 		}
@@ -2,22 +2,34 @@
 #include "pch.h"
 #include "SNES/IMemoryHandler.h"
 #include "SNES/Coprocessors/GSU/GsuTypes.h"
+#include "SNES/Coprocessors/GSU/Gsu.h"
 #include "Shared/MemoryType.h"
 
 class GsuRomHandler : public IMemoryHandler
 {
 private:
+	Gsu *_gsu;
 	GsuState *_state;
 	IMemoryHandler *_romHandler;
 
 public:
-	GsuRomHandler(GsuState &state, IMemoryHandler *romHandler) : IMemoryHandler(MemoryType::SnesPrgRom)
+	GsuRomHandler(Gsu *gsu, GsuState &state, IMemoryHandler *romHandler) : IMemoryHandler(MemoryType::SnesPrgRom)
 	{
+		_gsu = gsu;
 		_romHandler = romHandler;
 		_state = &state;
 	}
 
 	uint8_t Read(uint32_t addr) override
+	{
+		if(_state->GsuRomAccess) {
+			//The ROM's content never changes, the GSU's state is only needed when it can own the ROM bus
+			_gsu->SyncThread();
+		}
+		return Peek(addr);
+	}
+
+	uint8_t Peek(uint32_t addr) override
 	{
 		if(!_state->SFR.Running || !_state->GsuRomAccess) {
 			return _romHandler->Read(addr);
@@ -38,15 +50,10 @@ public:
 		}
 	}
 
-	uint8_t Peek(uint32_t addr) override
-	{
-		return Read(addr);
-	}
-
 	void PeekBlock(uint32_t addr, uint8_t *output) override
 	{
 		for(int i = 0; i < 0x1000; i++) {
-			output[i] = Read(i);
+			output[i] = Peek(i);
 		}
 	}
 
@@ -119,3 +119,8 @@ AddressInfo Sdd1::GetAbsoluteAddress(uint32_t address)
 {
 	return { -1, MemoryType::None };
 }
+
+DecompressionCacheState Sdd1::GetCacheState()
+{
+	return _sdd1Mmc->GetCacheState();
+}
@@ -2,6 +2,7 @@
 #include "pch.h"
 #include "SNES/Coprocessors/BaseCoprocessor.h"
 #include "SNES/Coprocessors/SDD1/Sdd1Types.h"
+#include "SNES/Coprocessors/DecompressionCache.h"
 
 class SnesConsole;
 class Sdd1Mmc;
@@ -23,4 +24,6 @@ public:
 	void Write(uint32_t addr, uint8_t value) override;
 	AddressInfo GetAbsoluteAddress(uint32_t address) override;
 	void Reset() override;
+
+	DecompressionCacheState GetCacheState();
 };
\ No newline at end of file
@@ -445,8 +445,22 @@ void SDD1_OL::Serialize(Serializer &s)
 
 void Sdd1Decomp::Init(Sdd1Mmc *mmc, uint32_t readAddr)
 {
-	uint8_t firstByte = mmc->ReadRom(readAddr);
-	IM.prepareDecomp(mmc, readAddr);
+	_mmc = mmc;
+	_origin = readAddr;
+	_streamPos = 0;
+
+	_cacheEntry = _cache.Find(readAddr, readAddr, [mmc](uint32_t addr) { return mmc->ReadRom(addr); });
+	_fromCache = _cacheEntry != nullptr;
+	if(!_fromCache) {
+		InitDecoder();
+		_cacheEntry = _cache.Add(readAddr);
+	}
+}
+
+void Sdd1Decomp::InitDecoder()
+{
+	uint8_t firstByte = _mmc->ReadRom(_origin);
+	IM.prepareDecomp(_mmc, _origin);
 	BG0.prepareDecomp();
 	BG1.prepareDecomp();
 	BG2.prepareDecomp();
@@ -462,11 +476,57 @@ void Sdd1Decomp::Init(Sdd1Mmc *mmc, uint32_t readAddr)
 
 uint8_t Sdd1Decomp::GetDecompressedByte()
 {
-	return OL.decompressByte();
+	if(_fromCache) {
+		if(_streamPos < _cacheEntry->Output.size()) {
+			return _cacheEntry->Output[_streamPos++];
+		}
+		RestoreDecoderState();
+	}
+
+	uint8_t value = OL.decompressByte();
+	_streamPos++;
+	if(_cacheEntry) {
+		AppendToCache(value);
+	}
+	return value;
+}
+
+void Sdd1Decomp::AppendToCache(uint8_t value)
+{
+	//The input manager can read up to 1 byte past its current read address
+	uint32_t sourceLength = IM.getReadAddr() + 2 - _origin;
+	Sdd1Mmc* mmc = _mmc;
+	if(!_cache.Append(_cacheEntry, &value, 1, _origin, sourceLength, [mmc](uint32_t addr) { return mmc->ReadRom(addr); })) {
+		_cacheEntry = nullptr;
+	}
+}
+
+void Sdd1Decomp::RestoreDecoderState()
+{
+	//Decode the stream up to the current position to get the decoder in the state it would be in without the cache
+	InitDecoder();
+	for(uint32_t i = 0; i < _streamPos; i++) {
+		OL.decompressByte();
+	}
+
+	_fromCache = false;
+	if(_cacheEntry->Output.size() != _streamPos) {
+		_cacheEntry = nullptr;
+	}
+}
+
+DecompressionCacheState Sdd1Decomp::GetCacheState()
+{
+	return _cache.GetState();
 }
 
 void Sdd1Decomp::Serialize(Serializer &s)
 {
+	if(s.IsSaving() && _fromCache) {
+		//Save states contain the decoder's state, keeping them compatible regardless of whether the cache was used or not
+		RestoreDecoderState();
+	}
+
 	SV(IM);
 	SV(BG0);
 	SV(BG1);
@@ -479,6 +539,11 @@ void Sdd1Decomp::Serialize(Serializer &s)
 	SV(PEM);
 	SV(CM);
 	SV(OL);
+
+	if(!s.IsSaving()) {
+		_fromCache = false;
+		_cacheEntry = nullptr;
+	}
 }
 
 Sdd1Decomp::Sdd1Decomp() :
@@ -1,6 +1,7 @@
 #pragma once
 #include "pch.h"
 #include "Utilities/ISerializable.h"
+#include "SNES/Coprocessors/DecompressionCache.h"
 
 /************************************************************************
 
@@ -41,6 +42,7 @@ public:
 	SDD1_IM(void) {}
 	void prepareDecomp(Sdd1Mmc *mmc, uint32_t readAddr);
 	uint8_t getCodeword(const uint8_t code_len);
+	uint32_t getReadAddr() { return _readAddr; }
 
 	void Serialize(Serializer &s) override;
 
@@ -168,9 +170,22 @@ public:
 	void Init(Sdd1Mmc *mmc, uint32_t readAddr);
 	uint8_t GetDecompressedByte();
 
+	DecompressionCacheState GetCacheState();
+
 	void Serialize(Serializer &s) override;
 
 private:
+	DecompressionCache _cache;
+	DecompressionCacheEntry* _cacheEntry = nullptr;
+	bool _fromCache = false;
+	Sdd1Mmc* _mmc = nullptr;
+	uint32_t _origin = 0;
+	uint32_t _streamPos = 0;
+
+	void InitDecoder();
+	void RestoreDecoderState();
+	void AppendToCache(uint8_t value);
+
 	SDD1_IM IM;
 	SDD1_GCD GCD;
 	SDD1_BG BG0;  SDD1_BG BG1;  SDD1_BG BG2;  SDD1_BG BG3;
@@ -80,6 +80,11 @@ void Sdd1Mmc::Write(uint32_t addr, uint8_t value)
 	//ROM, read-only
 }
 
+DecompressionCacheState Sdd1Mmc::GetCacheState()
+{
+	return _decompressor.GetCacheState();
+}
+
 AddressInfo Sdd1Mmc::GetAbsoluteAddress(uint32_t address)
 {
 	return GetHandler(address)->GetAbsoluteAddress(address);
@@ -22,6 +22,8 @@ public:
 
 	uint8_t ReadRom(uint32_t addr);
 
+	DecompressionCacheState GetCacheState();
+
 	// Inherited via IMemoryHandler
 	virtual uint8_t Read(uint32_t addr) override;
 	virtual uint8_t Peek(uint32_t addr) override;
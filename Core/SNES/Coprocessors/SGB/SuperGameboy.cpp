@@ -27,6 +27,9 @@ SuperGameboy::SuperGameboy(SnesConsole* console, Gameboy* gameboy)
 	_controlManager = (GbControlManager*)gameboy->GetControlManager();
 	_ppu = gameboy->GetPpu();
 
+	_useWorkerThread = _emu->GetSettings()->GetSnesConfig().RunSgbOnSeparateThread;
+	_worker.reset(new CoprocessorWorker([this](uint64_t targetCycle) { _gameboy->Run(targetCycle); }));
+
 	_control = 0x01; //Divider = 5, gameboy = not running
 	UpdateClockRatio();
 	
@@ -41,11 +44,14 @@ SuperGameboy::SuperGameboy(SnesConsole* console, Gameboy* gameboy)
 
 SuperGameboy::~SuperGameboy()
 {
+	_worker->Stop();
 	_emu->GetSoundMixer()->UnregisterAudioProvider(this);
 }
 
 void SuperGameboy::Reset()
 {
+	SyncThread();
+
 	_control = 0;
 	_resetClock = 0;
 
@@ -68,6 +74,8 @@ void SuperGameboy::Reset()
 
 uint8_t SuperGameboy::Read(uint32_t addr)
 {
+	SyncThread();
+
 	addr &= 0xF80F;
 	
 	if(addr >= 0x7000 && addr <= 0x700F) {
@@ -104,6 +112,8 @@ uint8_t SuperGameboy::Read(uint32_t addr)
 
 void SuperGameboy::Write(uint32_t addr, uint8_t value)
 {
+	SyncThread();
+
 	addr &= 0xF80F;
 
 	switch(addr & 0xFFFF) {
@@ -191,7 +201,9 @@ void SuperGameboy::ProcessInputPortWrite(uint8_t value)
 	}
 
 	_inputValue = value;
-	_inputWriteClock = _memoryManager->GetMasterClock();
+
+	//Called by the Game Boy, which may be running on the worker thread - derive the master clock from the Game Boy's clock
+	_inputWriteClock = _resetClock + (uint64_t)((_gameboy->GetCycleCount() - _clockOffset) / _clockRatio);
 }
 
 void SuperGameboy::LogPacket()
@@ -270,6 +282,8 @@ uint8_t SuperGameboy::GetPlayerCount()
 
 void SuperGameboy::MixAudio(int16_t* out, uint32_t sampleCount, uint32_t sampleRate)
 {
+	SyncThread();
+
 	int16_t* gbSamples = nullptr;
 	uint32_t gbSampleCount = 0;
 	_gameboy->GetSoundSamples(gbSamples, gbSampleCount);
@@ -280,13 +294,56 @@ void SuperGameboy::MixAudio(int16_t* out, uint32_t sampleCount, uint32_t sampleR
 	}
 }
 
+uint64_t SuperGameboy::GetGameboyTargetCycle()
+{
+	return _clockOffset + (uint64_t)((_memoryManager->GetMasterClock() - _resetClock) * _clockRatio);
+}
+
 void SuperGameboy::Run()
 {
 	if(!(_control & 0x80)) {
 		return;
 	}
 
-	_gameboy->Run(_clockOffset + (uint64_t)((_memoryManager->GetMasterClock() - _resetClock) * _clockRatio));
+	uint64_t targetCycle = GetGameboyTargetCycle();
+	if(_worker->IsRunning()) {
+		if(targetCycle - _workerPublishedCycle >= SuperGameboy::WorkerSyncInterval) {
+			_workerPublishedCycle = targetCycle;
+			_worker->SetTarget(targetCycle);
+		}
+		return;
+	}
+
+	_gameboy->Run(targetCycle);
+
+	if(_useWorkerThread && CanUseWorkerThread()) {
+		_workerPublishedCycle = targetCycle;
+		_worker->Start(targetCycle);
+	}
+}
+
+bool SuperGameboy::CanUseWorkerThread()
+{
+	//The debugger needs the Game Boy to run in lockstep with the SNES
+	return !_emu->IsDebugging() && _memoryManager->GetMasterClock() >= _workerRestartClock;
+}
+
+void SuperGameboy::SyncThread()
+{
+	if(!_worker->IsRunning()) {
+		return;
+	}
+
+	//Let the Game Boy catch up to the SNES. The Game Boy only depends on the SNES through the ICD2
+	//registers (which synchronize before being accessed), so it ends up in the same state as in lockstep.
+	_worker->Sync(GetGameboyTargetCycle());
+	_workerRestartClock = _memoryManager->GetMasterClock() + SuperGameboy::WorkerRestartDelay;
+}
+
+void SuperGameboy::ProcessEndOfFrame()
+{
+	SyncThread();
+	_useWorkerThread = _emu->GetSettings()->GetSnesConfig().RunSgbOnSeparateThread;
 }
 
 void SuperGameboy::UpdateClockRatio()
@@ -304,10 +361,14 @@ void SuperGameboy::UpdateClockRatio()
 
 	double effectiveRate = (double)masterRate / divider;
 	if(effectiveRate != _effectiveClockRate) {
+		SyncThread();
+
 		_effectiveClockRate = effectiveRate;
 
 		double clockRatio = _effectiveClockRate / _console->GetMasterClockRate();
-		Run();
+		if(_control & 0x80) {
+			_gameboy->Run(GetGameboyTargetCycle());
+		}
 		_clockOffset = _gameboy->GetCycleCount();
 		_resetClock = _memoryManager->GetMasterClock();
 		_clockRatio = clockRatio;
@@ -360,6 +421,8 @@ AddressInfo SuperGameboy::GetAbsoluteAddress(uint32_t address)
 
 void SuperGameboy::Serialize(Serializer& s)
 {
+	SyncThread();
+
 	SV(_control); SV(_resetClock); SV(_input[0]); SV(_input[1]); SV(_input[2]); SV(_input[3]); SV(_inputIndex); SV(_listeningForPacket); SV(_packetReady);
 	SV(_inputWriteClock); SV(_inputValue); SV(_packetByte); SV(_packetBit); SV(_lcdRowSelect); SV(_readPosition); SV(_waitForHigh); SV(_clockRatio);
 
@@ -2,6 +2,7 @@
 #include "pch.h"
 #include "SNES/Coprocessors/BaseCoprocessor.h"
 #include "Shared/Interfaces/IAudioProvider.h"
+#include "SNES/Coprocessors/CoprocessorWorker.h"
 #include "Utilities/Audio/HermiteResampler.h"
 
 class SnesConsole;
@@ -49,6 +50,20 @@ private:
 	
 	HermiteResampler _resampler;
 
+	//Number of Game Boy cycles between each update of the worker thread's target cycle
+	static constexpr uint64_t WorkerSyncInterval = 256;
+	//Number of master clocks to run the Game Boy on the CPU thread after a synchronization, before using the worker thread again
+	static constexpr uint64_t WorkerRestartDelay = 1024;
+
+	//When the worker is running, the Game Boy's state (and the ICD2 state it updates) may only be accessed by the worker thread
+	unique_ptr<CoprocessorWorker> _worker;
+	bool _useWorkerThread = false;
+	uint64_t _workerPublishedCycle = 0;
+	uint64_t _workerRestartClock = 0;
+
+	uint64_t GetGameboyTargetCycle();
+	bool CanUseWorkerThread();
+
 	uint8_t GetLcdRow();
 	uint8_t GetLcdBufferRow();
 	uint8_t GetPlayerCount();
@@ -66,6 +81,8 @@ public:
 	void Write(uint32_t addr, uint8_t value) override;
 
 	void Run() override;
+	void ProcessEndOfFrame() override;
+	void SyncThread() override;
 
 	void ProcessInputPortWrite(uint8_t value);
 
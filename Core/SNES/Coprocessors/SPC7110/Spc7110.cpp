@@ -326,6 +326,11 @@ uint8_t Spc7110::ReadDataRom(uint32_t addr)
 	return _cart->DebugGetPrgRom()[0x100000 + addr];
 }
 
+DecompressionCacheState Spc7110::GetCacheState()
+{
+	return _decomp->GetCacheState();
+}
+
 void Spc7110::FillReadBuffer()
 {
 	int32_t offset = _readMode & 0x02 ? _readOffset : 0;
@@ -73,6 +73,8 @@ public:
 	
 	uint8_t ReadDataRom(uint32_t addr);
 
+	DecompressionCacheState GetCacheState();
+
 	void Serialize(Serializer& s) override;
 	uint8_t Read(uint32_t addr) override;
 	uint8_t Peek(uint32_t addr) override;
@@ -47,11 +47,28 @@ uint64_t Spc7110Decomp::MoveToFront(uint64_t list, uint32_t nibble)
 }
 
 void Spc7110Decomp::Initialize(uint32_t mode, uint32_t origin)
+{
+	_mode = mode;
+	_origin = origin;
+	_streamPos = 0;
+	_bpp = 1 << mode;
+
+	Spc7110* spc = _spc;
+	uint64_t key = ((uint64_t)mode << 32) | origin;
+	_cacheEntry = _cache.Find(key, origin, [spc](uint32_t addr) { return spc->ReadDataRom(addr); });
+	_fromCache = _cacheEntry != nullptr;
+	if(!_fromCache) {
+		InitDecoder();
+		_cacheEntry = _cache.Add(key);
+	}
+}
+
+void Spc7110Decomp::InitDecoder()
 {
 	memset(_context, 0, sizeof(_context));
 
-	_bpp = 1 << mode;
-	_offset = origin;
+	_bpp = 1 << _mode;
+	_offset = _origin;
 	_bits = 8;
 	_range = Max + 1;
 	_input = ReadByte();
@@ -62,6 +79,46 @@ void Spc7110Decomp::Initialize(uint32_t mode, uint32_t origin)
 }
 
 void Spc7110Decomp::Decode()
+{
+	if(_fromCache) {
+		if((_streamPos + 1) * sizeof(_result) <= _cacheEntry->Output.size()) {
+			memcpy(&_result, _cacheEntry->Output.data() + _streamPos * sizeof(_result), sizeof(_result));
+			_streamPos++;
+			return;
+		}
+		RestoreDecoderState();
+	}
+
+	DecodeBlock();
+	_streamPos++;
+	if(_cacheEntry) {
+		AppendToCache();
+	}
+}
+
+void Spc7110Decomp::AppendToCache()
+{
+	Spc7110* spc = _spc;
+	if(!_cache.Append(_cacheEntry, (uint8_t*)&_result, sizeof(_result), _origin, _offset - _origin, [spc](uint32_t addr) { return spc->ReadDataRom(addr); })) {
+		_cacheEntry = nullptr;
+	}
+}
+
+void Spc7110Decomp::RestoreDecoderState()
+{
+	//Decode the stream up to the current position to get the decoder in the state it would be in without the cache
+	InitDecoder();
+	for(uint32_t i = 0; i < _streamPos; i++) {
+		DecodeBlock();
+	}
+
+	_fromCache = false;
+	if(_cacheEntry->Output.size() != _streamPos * sizeof(_result)) {
+		_cacheEntry = nullptr;
+	}
+}
+
+void Spc7110Decomp::DecodeBlock()
 {
 	for(uint32_t pixel = 0; pixel < 8; pixel++) {
 		uint64_t map = _colormap;
@@ -160,8 +217,18 @@ uint8_t Spc7110Decomp::GetBpp()
 	return _bpp;
 }
 
+DecompressionCacheState Spc7110Decomp::GetCacheState()
+{
+	return _cache.GetState();
+}
+
 void Spc7110Decomp::Serialize(Serializer& s)
 {
+	if(s.IsSaving() && _fromCache) {
+		//Save states contain the decoder's state, keeping them compatible regardless of whether the cache was used or not
+		RestoreDecoderState();
+	}
+
 	SV(_bpp); SV(_offset); SV(_bits); SV(_range); SV(_input); SV(_output); SV(_pixels); SV(_colormap); SV(_result);
 	for(int i = 0; i < 15; i++) {
 		SV(_context[0][i].swap); SV(_context[0][i].prediction);
@@ -170,6 +237,11 @@ void Spc7110Decomp::Serialize(Serializer& s)
 		SV(_context[3][i].swap); SV(_context[3][i].prediction);
 		SV(_context[4][i].swap); SV(_context[4][i].prediction);
 	}
+
+	if(!s.IsSaving()) {
+		_fromCache = false;
+		_cacheEntry = nullptr;
+	}
 }
 
 Spc7110Decomp::ModelState Spc7110Decomp::evolution[53] = {
@@ -1,6 +1,7 @@
 #pragma once
 #include "pch.h"
 #include "Utilities/ISerializable.h"
+#include "SNES/Coprocessors/DecompressionCache.h"
 
 //Based on bsnes' code (by byuu)
 //original implementation: neviksti
@@ -40,7 +41,19 @@ private:
 	uint64_t _colormap;      //most recently used list
 	uint32_t _result;        //decompressed word after calling decode()
 
+	DecompressionCache _cache;
+	DecompressionCacheEntry* _cacheEntry = nullptr;
+	bool _fromCache = false;
+	uint32_t _mode = 0;
+	uint32_t _origin = 0;
+	uint32_t _streamPos = 0;
+
 private:
+	void InitDecoder();
+	void DecodeBlock();
+	void RestoreDecoderState();
+	void AppendToCache();
+
 	uint8_t ReadByte();
 	uint32_t Deinterleave(uint64_t data, uint32_t bits);
 	uint64_t MoveToFront(uint64_t list, uint32_t nibble);
@@ -54,5 +67,7 @@ public:
 	uint32_t GetResult();
 	uint8_t GetBpp();
 
+	DecompressionCacheState GetCacheState();
+
 	void Serialize(Serializer& s) override;
 };
\ No newline at end of file
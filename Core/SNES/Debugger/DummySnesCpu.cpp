@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "SNES/Debugger/DummySnesCpu.h"
+#include "Debugger/CpuTestBus.h"
 
 #define DUMMYCPU
 #define SnesCpu DummySnesCpu
@@ -16,8 +17,21 @@ DummySnesCpu::DummySnesCpu(SnesConsole* console, CpuType type)
 	_memoryManager = nullptr;
 }
 
+DummySnesCpu::DummySnesCpu(CpuTestBus* testBus)
+{
+	_console = nullptr;
+	_memoryMappings = nullptr;
+	_dmaController = nullptr;
+	_memoryManager = nullptr;
+	_testBus = testBus;
+}
+
 uint8_t DummySnesCpu::Read(uint32_t addr, MemoryOperationType type)
 {
+	if(_testBus) {
+		return _testBus->Read(addr, type);
+	}
+
 	uint8_t value = _memoryMappings->Peek(addr);
 	LogMemoryOperation(addr, value, type);
 	return value;
@@ -25,6 +39,10 @@ uint8_t DummySnesCpu::Read(uint32_t addr, MemoryOperationType type)
 
 void DummySnesCpu::Write(uint32_t addr, uint8_t value, MemoryOperationType type)
 {
+	if(_testBus) {
+		_testBus->Write(addr, value, type);
+		return;
+	}
 	LogMemoryOperation(addr, value, type);
 }
 
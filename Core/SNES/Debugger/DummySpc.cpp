@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "SNES/Debugger/DummySpc.h"
+#include "Debugger/CpuTestBus.h"
 
 #define DUMMYSPC
 #define Spc DummySpc
@@ -22,7 +22,7 @@ void GsuDisUtils::GetDisassembly(DisassemblyInfo &info, string &out, uint32_t me
 	auto getJumpTarget = [&str, labelManager, memoryAddr, &info]() {
 		uint32_t jmpTarget = memoryAddr + (int8_t)info.GetByteCode()[1] + 2;
 		AddressInfo address = { (int32_t)jmpTarget, MemoryType::GsuMemory };
-		string label = labelManager ? labelManager->GetLabel(address) : "";
+		string_view label = labelManager ? labelManager->GetLabelView(address) : string_view();
 		if(label.empty()) {
 			str.WriteAll('$', HexUtilities::ToHex24(jmpTarget));
 		} else {
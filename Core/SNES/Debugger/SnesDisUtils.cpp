@@ -26,7 +26,7 @@ void SnesDisUtils::GetDisassembly(DisassemblyInfo &info, string &out, uint32_t m
 	if(opSize > 1) {
 		if(addrMode == SnesAddrMode::Rel || addrMode == SnesAddrMode::RelLng || opSize == 4) {
 			AddressInfo address { (int32_t)opAddr, MemoryType::SnesMemory };
-			string label = labelManager ? labelManager->GetLabel(address) : "";
+			string_view label = labelManager ? labelManager->GetLabelView(address) : string_view();
 			if(label.size()) {
 				operand.Write(label, true);
 			} else {
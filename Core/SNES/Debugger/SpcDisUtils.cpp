@@ -111,7 +111,7 @@ void SpcDisUtils::GetDisassembly(DisassemblyInfo &info, string &out, uint32_t me
 	AddressInfo addrInfo { 0, MemoryType::SpcMemory };
 	auto getOperand = [&str, &addrInfo, labelManager](uint16_t addr) {
 		addrInfo.Address = addr;
-		string label = labelManager ? labelManager->GetLabel(addrInfo) : "";
+		string_view label = labelManager ? labelManager->GetLabelView(addrInfo) : string_view();
 		if(label.empty()) {
 			str.WriteAll('$', HexUtilities::ToHex(addr));
 		} else {
@@ -30,10 +30,13 @@ uint8_t RegisterHandlerB::Read(uint32_t addr)
 		return _spc->CpuReadRegister(addr & 0x03);
 	} else if(addr == 0x2180) {
 		uint8_t value = _workRam[_wramPosition];
-		if(_cheatManager->HasCheats<CpuType::Snes>()) {
-			_cheatManager->ApplyCheat<CpuType::Snes>(0x7E0000 | _wramPosition, value);
+		uint8_t instrumentation = _emu->GetInstrumentation();
+		if(instrumentation) {
+			if(instrumentation & InstrumentationFlags::Cheats) {
+				_cheatManager->ApplyCheat<CpuType::Snes>(0x7E0000 | _wramPosition, value);
+			}
+			_emu->ProcessMemoryRead<CpuType::Snes>(instrumentation, 0x7E0000 | _wramPosition, value, MemoryOperationType::Read);
 		}
-		_emu->ProcessMemoryRead<CpuType::Snes>(0x7E0000 | _wramPosition, value, MemoryOperationType::Read);
 		_wramPosition = (_wramPosition + 1) & 0x1FFFF;
 		return value;
 	} else if(addr >= 0x2300 && addr <= 0x23FF && _console->GetCartridge()->GetSa1()) {
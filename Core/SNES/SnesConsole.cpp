@@ -23,6 +23,8 @@
 #include "SNES/Coprocessors/SA1/Sa1.h"
 #include "SNES/Coprocessors/GSU/Gsu.h"
 #include "SNES/Coprocessors/CX4/Cx4.h"
+#include "SNES/Coprocessors/SDD1/Sdd1.h"
+#include "SNES/Coprocessors/SPC7110/Spc7110.h"
 #include "Shared/Emulator.h"
 #include "Shared/TimingInfo.h"
 #include "Shared/EmuSettings.h"
@@ -61,6 +63,11 @@ void SnesConsole::RunFrame()
 	while(_frameRunning) {
 		_cpu->Exec();
 	}
+
+	if(BaseCoprocessor* coprocessor = _cart->GetCoprocessor()) {
+		//Make sure coprocessors running on another thread are idle between frames (e.g while the debugger is being attached)
+		coprocessor->SyncThread();
+	}
 }
 
 void SnesConsole::ProcessEndOfFrame()
@@ -308,6 +315,11 @@ void SnesConsole::ProcessAudioPlayerAction(AudioPlayerActionParams p)
 
 void SnesConsole::Serialize(Serializer& s)
 {
+	if(BaseCoprocessor* coprocessor = _cart->GetCoprocessor()) {
+		//Applies any IRQ raised by the coprocessor's thread to the CPU before saving it
+		coprocessor->SyncThread();
+	}
+
 	SV(_cpu);
 	SV(_memoryManager);
 	SV(_ppu);
@@ -492,6 +504,11 @@ void SnesConsole::GetConsoleState(BaseState& baseState, ConsoleType consoleType)
 	if(_cart->GetCx4()) {
 		state.Cx4 = _cart->GetCx4()->GetState();
 	}
+	if(_cart->GetSdd1()) {
+		state.DecompressionCache = _cart->GetSdd1()->GetCacheState();
+	} else if(_cart->GetSpc7110()) {
+		state.DecompressionCache = _cart->GetSpc7110()->GetCacheState();
+	}
 }
 
 void SnesConsole::InitializeRam(void* data, uint32_t length)
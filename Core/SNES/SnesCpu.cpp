@@ -7,6 +7,7 @@
 #include "SNES/SnesConsole.h"
 #include "SNES/SnesMemoryManager.h"
 #include "SNES/SnesDmaController.h"
+#include "SNES/Coprocessors/BaseCoprocessor.h"
 #include "SNES/SnesCpu.Instructions.h"
 #include "SNES/SnesCpu.Shared.h"
 #include "Shared/EventType.h"
@@ -20,6 +21,14 @@ SnesCpu::SnesCpu(SnesConsole *console)
 	_memoryManager = console->GetMemoryManager();
 	_dmaController = console->GetDmaController();
 }
+
+__forceinline void SnesCpu::SyncCoprocessorIrq()
+{
+	//The coprocessor's IRQ can only affect the CPU when IRQs are enabled (WAI is handled separately)
+	if(_threadedCoprocessor && !CheckFlag(ProcFlags::IrqDisable)) {
+		_threadedCoprocessor->SyncIrq();
+	}
+}
 #endif
 
 SnesCpu::~SnesCpu()
@@ -70,6 +79,9 @@ void SnesCpu::ProcessHaltedState()
 	} else {
 		//WAI
 		Idle();
+		if(_threadedCoprocessor) {
+			_threadedCoprocessor->SyncIrq();
+		}
 		if(_state.IrqSource || _state.NeedNmi) {
 			Idle();
 			Idle();
@@ -85,6 +97,7 @@ void SnesCpu::Idle()
 	ProcessCpuCycle();
 	_memoryManager->IncMasterClock6();
 	_emu->ProcessIdleCycle<CpuType::Snes>();
+	SyncCoprocessorIrq();
 	UpdateIrqNmiFlags();
 #endif
 }
@@ -123,6 +136,7 @@ uint8_t SnesCpu::Read(uint32_t addr, MemoryOperationType type)
 	_memoryManager->SetCpuSpeed(_memoryManager->GetCpuSpeed(addr));
 	ProcessCpuCycle();
 	uint8_t value = _memoryManager->Read(addr, type);
+	SyncCoprocessorIrq();
 	UpdateIrqNmiFlags();
 	return value;
 }
@@ -132,6 +146,12 @@ void SnesCpu::Write(uint32_t addr, uint8_t value, MemoryOperationType type)
 	_memoryManager->SetCpuSpeed(_memoryManager->GetCpuSpeed(addr));
 	ProcessCpuCycle();
 	_memoryManager->Write(addr, value, type);
+	SyncCoprocessorIrq();
 	UpdateIrqNmiFlags();
 }
+
+void SnesCpu::SetThreadedCoprocessor(BaseCoprocessor* coprocessor)
+{
+	_threadedCoprocessor = coprocessor;
+}
 #endif
@@ -1,8 +1,8 @@
-#if (defined(DUMMYCPU) && !defined(__DUMMYCPU__H)) || (!defined(DUMMYCPU) && !defined(__CPU__H))
+#if (defined(DUMMYCPU) && !defined(__DUMMYSNESCPU__H)) || (!defined(DUMMYCPU) && !defined(__SNESCPU__H))
 #ifdef DUMMYCPU
-#define __DUMMYCPU__H
+#define __DUMMYSNESCPU__H
 #else
-#define __CPU__H
+#define __SNESCPU__H
 #endif
 
 #include "pch.h"
@@ -15,6 +15,8 @@ class SnesMemoryManager;
 class SnesDmaController;
 class SnesConsole;
 class Emulator;
+class BaseCoprocessor;
+struct CpuTestBus;
 
 class SnesCpu : public ISerializable
 {
@@ -37,6 +39,9 @@ private:
 	Emulator *_emu = nullptr;
 	SnesConsole *_console = nullptr;
 
+	//Coprocessor that runs on a separate thread, and must be synchronized before the IRQ line is checked
+	BaseCoprocessor *_threadedCoprocessor = nullptr;
+
 	bool _immediateMode = false;
 
 	SnesCpuState _state = {};
@@ -55,6 +60,7 @@ private:
 	uint16_t GetResetVector();
 
 	void UpdateIrqNmiFlags();
+	void SyncCoprocessorIrq();
 	void ProcessCpuCycle();
 
 	void Idle();
@@ -324,6 +330,7 @@ public:
 	SnesCpu(SnesConsole *console);
 #else
 	DummySnesCpu(SnesConsole* console, CpuType type);
+	DummySnesCpu(CpuTestBus* testBus);
 #endif
 
 	virtual ~SnesCpu();
@@ -346,12 +353,15 @@ public:
 	bool CheckIrqSource(SnesIrqSource source);
 	void ClearIrqSource(SnesIrqSource source);
 
+	void SetThreadedCoprocessor(BaseCoprocessor* coprocessor);
+
 	// Inherited via ISerializable
 	void Serialize(Serializer &s) override;
 
 #ifdef DUMMYCPU
 private:
 	MemoryMappings* _memoryMappings = nullptr;
+	CpuTestBus* _testBus = nullptr;
 
 	uint32_t _memOpCounter = 0;
 	MemoryOperationInfo _memOperations[10] = {};
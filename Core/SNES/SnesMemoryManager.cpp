@@ -251,11 +251,14 @@ uint8_t SnesMemoryManager::Read(uint32_t addr, MemoryOperationType type)
 		value = _openBus;
 		LogDebug("[Debug] Read - missing handler: $" + HexUtilities::ToHex(addr));
 	}
-	if(_cheatManager->HasCheats<CpuType::Snes>()) {
-		_cheatManager->ApplyCheat<CpuType::Snes>(addr, value);
-	}
 	IncMasterClock4();
-	_emu->ProcessMemoryRead<CpuType::Snes>(addr, value, type);
+	uint8_t instrumentation = _emu->GetInstrumentation();
+	if(instrumentation) {
+		if(instrumentation & InstrumentationFlags::Cheats) {
+			_cheatManager->ApplyCheat<CpuType::Snes>(addr, value);
+		}
+		_emu->ProcessMemoryRead<CpuType::Snes>(instrumentation, addr, value, type);
+	}
 	return value;
 }
 
@@ -290,10 +293,13 @@ uint8_t SnesMemoryManager::ReadDma(uint32_t addr, bool forBusA)
 		value = _openBus;
 		LogDebug("[Debug] Read - missing handler: $" + HexUtilities::ToHex(addr));
 	}
-	if(_cheatManager->HasCheats<CpuType::Snes>()) {
-		_cheatManager->ApplyCheat<CpuType::Snes>(addr, value);
+	uint8_t instrumentation = _emu->GetInstrumentation();
+	if(instrumentation) {
+		if(instrumentation & InstrumentationFlags::Cheats) {
+			_cheatManager->ApplyCheat<CpuType::Snes>(addr, value);
+		}
+		_emu->ProcessMemoryRead<CpuType::Snes>(instrumentation, addr, value, MemoryOperationType::DmaRead);
 	}
-	_emu->ProcessMemoryRead<CpuType::Snes>(addr, value, MemoryOperationType::DmaRead);
 	return value;
 }
 
@@ -8,6 +8,7 @@
 #include "SNES/Coprocessors/SA1/Sa1Types.h"
 #include "SNES/Coprocessors/GSU/GsuTypes.h"
 #include "SNES/Coprocessors/CX4/Cx4Types.h"
+#include "SNES/Coprocessors/DecompressionCache.h"
 #include "SNES/DmaControllerTypes.h"
 #include "SNES/InternalRegisterTypes.h"
 #include "SNES/AluMulDiv.h"
@@ -23,6 +24,7 @@ struct SnesState
 	DebugSa1State Sa1;
 	GsuState Gsu;
 	Cx4State Cx4;
+	DecompressionCacheState DecompressionCache;
 
 	SnesDmaControllerState Dma;
 	InternalRegisterState InternalRegs;
@@ -208,6 +208,12 @@ uint8_t Spc::Read(uint16_t addr, MemoryOperationType type)
 {
 	IncCycleCount(addr);
 
+#ifdef DUMMYSPC
+	if(_testBus) {
+		return _testBus->Read(addr, type);
+	}
+#endif
+
 	uint8_t value;
 	if(addr >= 0xFFC0 && _state.RomEnabled) {
 		value = _spcBios[addr & 0x3F];
@@ -259,6 +265,10 @@ void Spc::Write(uint16_t addr, uint8_t value, MemoryOperationType type)
 	IncCycleCount(addr);
 
 #ifdef DUMMYSPC
+	if(_testBus) {
+		_testBus->Write(addr, value, type);
+		return;
+	}
 	LogMemoryOperation(addr, value, type);
 #else
 
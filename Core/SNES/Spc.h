@@ -19,6 +19,7 @@ class SnesMemoryManager;
 class SpcFileData;
 class Dsp;
 struct AddressInfo;
+struct CpuTestBus;
 
 class Spc : public ISerializable
 {
@@ -323,6 +324,7 @@ public:
 private:
 	uint32_t _memOpCounter = 0;
 	MemoryOperationInfo _memOperations[10] = {};
+	CpuTestBus* _testBus = nullptr;
 
 	void LogMemoryOperation(uint32_t addr, uint8_t value, MemoryOperationType type);
 
@@ -332,6 +334,7 @@ public:
 	void Step();
 
 	void SetDummyState(SpcState &state);
+	void SetTestBus(CpuTestBus* testBus) { _testBus = testBus; }
 
 	uint32_t GetOperationCount();
 	MemoryOperationInfo GetOperationInfo(uint32_t index);
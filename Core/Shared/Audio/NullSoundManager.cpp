@@ -0,0 +1,89 @@
+#include "pch.h"
+#include "Shared/Audio/NullSoundManager.h"
+#include "Shared/Audio/SoundMixer.h"
+#include "Shared/Emulator.h"
+#include "Shared/EmuSettings.h"
+
+NullSoundManager::NullSoundManager(Emulator* emu)
+{
+	_emu = emu;
+	_isStereo = true;
+	_emu->GetSoundMixer()->RegisterAudioDevice(this);
+}
+
+NullSoundManager::~NullSoundManager()
+{
+}
+
+void NullSoundManager::UpdateReadPosition()
+{
+	if(!_playing) {
+		return;
+	}
+
+	uint32_t bytesPerSample = _isStereo ? 4 : 2;
+	uint64_t position = _playStartPosition + (uint64_t)(_playTimer.GetElapsedMS() * _sampleRate / 1000) * bytesPerSample;
+	if(position > _bytesWritten) {
+		//The simulated device ran out of samples - restart playback once enough samples are available again
+		_bufferUnderrunEventCount++;
+		_bytesRead = _bytesWritten;
+		_playing = false;
+	} else if(_bytesWritten - position > _bufferSize) {
+		//Samples are produced faster than they are consumed (e.g fast forward), the oldest ones are overwritten
+		_bytesRead = _bytesWritten - _bufferSize;
+		_playStartPosition = _bytesRead;
+		_playTimer.Reset();
+	} else {
+		_bytesRead = position;
+	}
+}
+
+void NullSoundManager::PlayBuffer(int16_t* soundBuffer, uint32_t sampleCount, uint32_t sampleRate, bool isStereo)
+{
+	uint32_t bytesPerSample = isStereo ? 4 : 2;
+	uint32_t latency = _emu->GetSettings()->GetAudioConfig().AudioLatency;
+	if(_sampleRate != sampleRate || _isStereo != isStereo) {
+		_sampleRate = sampleRate;
+		_isStereo = isStereo;
+
+		//Use the same buffer size as the other audio devices
+		int32_t requestedByteLatency = (int32_t)((float)(sampleRate * latency) / 1000.0f * bytesPerSample);
+		_bufferSize = (int32_t)std::ceil((double)requestedByteLatency * 2 / 0x10000) * 0x10000;
+		Stop();
+	}
+
+	UpdateReadPosition();
+	_bytesWritten += sampleCount * bytesPerSample;
+
+	uint64_t byteLatency = (uint64_t)((float)(sampleRate * latency) / 1000.0f * bytesPerSample);
+	if(!_playing && _bytesWritten - _bytesRead > byteLatency) {
+		//Start playing
+		_playing = true;
+		_playStartPosition = _bytesRead;
+		_playTimer.Reset();
+	}
+}
+
+void NullSoundManager::Pause()
+{
+	UpdateReadPosition();
+	_playing = false;
+}
+
+void NullSoundManager::Stop()
+{
+	_playing = false;
+	_bytesWritten = 0;
+	_bytesRead = 0;
+	ResetStats();
+}
+
+void NullSoundManager::ProcessEndOfFrame()
+{
+	if(_sampleRate == 0) {
+		return;
+	}
+
+	UpdateReadPosition();
+	ProcessLatency((uint32_t)(_bytesRead % _bufferSize), (uint32_t)(_bytesWritten % _bufferSize));
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include "pch.h"
+#include "Shared/Audio/BaseSoundManager.h"
+#include "Utilities/Timer.h"
+
+class Emulator;
+
+//Audio device that discards all samples - it simulates a device consuming the samples in real time
+//to keep the latency/underrun statistics meaningful (for headless servers without any audio hardware)
+class NullSoundManager : public BaseSoundManager
+{
+private:
+	Emulator* _emu = nullptr;
+
+	Timer _playTimer;
+	bool _playing = false;
+	uint64_t _bytesWritten = 0;
+	uint64_t _bytesRead = 0;
+	uint64_t _playStartPosition = 0;
+
+	void UpdateReadPosition();
+
+public:
+	NullSoundManager(Emulator* emu);
+	virtual ~NullSoundManager();
+
+	void PlayBuffer(int16_t* soundBuffer, uint32_t sampleCount, uint32_t sampleRate, bool isStereo) override;
+	void Pause() override;
+	void Stop() override;
+	void ProcessEndOfFrame() override;
+
+	string GetAvailableDevices() override { return ""; }
+	void SetAudioDevice(string deviceName) override {}
+};
@@ -90,8 +90,8 @@ void SoundMixer::PlayAudioBuffer(int16_t* samples, uint32_t sampleCount, uint32_
 	_leftSample = samples[0];
 	_rightSample = samples[1];
 
+	//The resampler overwrites every sample it returns, no need to clear the buffer
 	int16_t *out = _sampleBuffer;
-	memset(_sampleBuffer, 0, 0x10000 * 2);
 	uint32_t count = _resampler->Resample(samples, sampleCount, sourceRate, cfg.SampleRate, out);
 
 	uint32_t targetRate = (uint32_t)(cfg.SampleRate * _resampler->GetRateAdjustment());
@@ -100,7 +100,7 @@ void SoundMixer::PlayAudioBuffer(int16_t* samples, uint32_t sampleCount, uint32_
 	}
 
 	if(cfg.EnableEqualizer) {
-		ProcessEqualizer(out, count, targetRate);
+		ProcessEqualizer(cfg, out, count);
 	}
 
 	if(audioPlayer) {
@@ -115,15 +115,9 @@ void SoundMixer::PlayAudioBuffer(int16_t* samples, uint32_t sampleCount, uint32_
 		}
 	}
 
-	if(cfg.CrossFeedEnabled) {
-		_crossFeedFilter->ApplyFilter(out, count, cfg.CrossFeedRatio);
-	}
-
-	if(masterVolume < 100) {
-		//Apply volume if not using the default value
-		for(uint32_t i = 0; i < count * 2; i++) {
-			out[i] = (int32_t)out[i] * (int32_t)masterVolume / 100;
-		}
+	if(cfg.CrossFeedEnabled || masterVolume < 100) {
+		//Cross feed and volume (if not using the default value) are applied in a single pass
+		_crossFeedFilter->ApplyFilter(out, count, cfg.CrossFeedEnabled ? (int)cfg.CrossFeedRatio : 0, (int)masterVolume);
 	}
 
 	RewindManager* rewindManager = _emu->GetRewindManager();
@@ -149,19 +143,20 @@ void SoundMixer::PlayAudioBuffer(int16_t* samples, uint32_t sampleCount, uint32_
 	}
 }
 
-void SoundMixer::ProcessEqualizer(int16_t* samples, uint32_t sampleCount, uint32_t targetRate)
+void SoundMixer::ProcessEqualizer(AudioConfig& cfg, int16_t* samples, uint32_t sampleCount)
 {
-	AudioConfig cfg = _emu->GetSettings()->GetAudioConfig();
 	if(!_equalizer) {
 		_equalizer.reset(new Equalizer());
 	}
-	vector<double> bandGains = {
+
+	double bandGains[Equalizer::BandCount] = {
 		cfg.Band1Gain, cfg.Band2Gain, cfg.Band3Gain, cfg.Band4Gain, cfg.Band5Gain,
 		cfg.Band6Gain, cfg.Band7Gain, cfg.Band8Gain, cfg.Band9Gain, cfg.Band10Gain,
 		cfg.Band11Gain, cfg.Band12Gain, cfg.Band13Gain, cfg.Band14Gain, cfg.Band15Gain,
 		cfg.Band16Gain, cfg.Band17Gain, cfg.Band18Gain, cfg.Band19Gain, cfg.Band20Gain
 	};
-	
+
+	//Only recalculates the filters when the sample rate or gains have changed
 	_equalizer->UpdateEqualizers(bandGains, cfg.SampleRate);
 	_equalizer->ApplyEqualizer(sampleCount, samples);
 }
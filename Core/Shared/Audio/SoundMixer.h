@@ -10,6 +10,7 @@ class WaveRecorder;
 class IAudioProvider;
 class CrossFeedFilter;
 class ReverbFilter;
+struct AudioConfig;
 
 class SoundMixer 
 {
@@ -28,7 +29,7 @@ private:
 	unique_ptr<CrossFeedFilter> _crossFeedFilter;
 	unique_ptr<ReverbFilter> _reverbFilter;
 
-	void ProcessEqualizer(int16_t *samples, uint32_t sampleCount, uint32_t targetRate);
+	void ProcessEqualizer(AudioConfig& cfg, int16_t* samples, uint32_t sampleCount);
 
 public:
 	SoundMixer(Emulator *emu);
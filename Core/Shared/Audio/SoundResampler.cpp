@@ -91,11 +91,18 @@ void SoundResampler::UpdateTargetSampleRate(uint32_t sourceRate, uint32_t sample
 		_previousTargetRate = targetRate;
 		_prevInputRate = inputRate;
 		_resampler.SetSampleRates(inputRate, targetRate);
+		_sincResampler.SetSampleRates(inputRate, targetRate);
 	}
 }
 
 uint32_t SoundResampler::Resample(int16_t *inSamples, uint32_t sampleCount, uint32_t sourceRate, uint32_t sampleRate, int16_t *outSamples)
 {
 	UpdateTargetSampleRate(sourceRate, sampleRate);
-	return _resampler.Resample<false>(inSamples, sampleCount, outSamples, 0);
+
+	switch(_emu->GetSettings()->GetAudioConfig().ResamplerQuality) {
+		case AudioResamplerQuality::Low: return _resampler.Resample<false>(inSamples, sampleCount, outSamples, 0);
+		case AudioResamplerQuality::Medium: _sincResampler.SetTapCount(16); break;
+		case AudioResamplerQuality::High: _sincResampler.SetTapCount(32); break;
+	}
+	return _sincResampler.Resample<false>(inSamples, sampleCount, outSamples, 0);
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #include "pch.h"
 #include "Utilities/Audio/HermiteResampler.h"
+#include "Utilities/Audio/SincResampler.h"
 
 class Emulator;
 
@@ -15,6 +16,7 @@ private:
 	int32_t _underTarget = 0;
 
 	HermiteResampler _resampler;
+	SincResampler _sincResampler;
 
 	double GetTargetRateAdjustment();
 	void UpdateTargetSampleRate(uint32_t sourceRate, uint32_t sampleRate);
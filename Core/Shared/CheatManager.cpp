@@ -47,6 +47,7 @@ bool CheatManager::AddCheat(CheatCode code)
 		_cheatsByAddress[cpuIndex].emplace(convertedCode->Address, convertedCode.value());
 		_hasCheats[cpuIndex] = true;
 		_bankHasCheats[cpuIndex][convertedCode->Address >> GetBankShift(convertedCode->Cpu)] = true;
+		_emu->UpdateInstrumentation();
 	}
 
 	return true;
@@ -90,6 +91,17 @@ void CheatManager::InternalClearCheats()
 	}
 	memset(_hasCheats, 0, sizeof(_hasCheats));
 	memset(_bankHasCheats, 0, sizeof(_bankHasCheats));
+	_emu->UpdateInstrumentation();
+}
+
+bool CheatManager::HasCheats()
+{
+	for(int i = 0; i < CpuTypeUtilities::GetCpuTypeCount(); i++) {
+		if(_hasCheats[i]) {
+			return true;
+		}
+	}
+	return false;
 }
 
 void CheatManager::ClearCheats(bool showMessage)
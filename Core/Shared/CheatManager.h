@@ -100,6 +100,8 @@ public:
 		return _hasCheats[(int)cpuType];
 	}
 
+	bool HasCheats();
+
 	template<CpuType cpuType>
 	__noinline void ApplyCheat(uint32_t addr, uint8_t& value);
 };
\ No newline at end of file
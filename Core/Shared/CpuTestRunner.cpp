@@ -0,0 +1,520 @@
+#include "pch.h"
+#include <chrono>
+#include "Shared/CpuTestRunner.h"
+#include "Shared/Emulator.h"
+#include "Debugger/CpuTestBus.h"
+#include "NES/NesConsole.h"
+#include "NES/Debugger/DummyNesCpu.h"
+#include "SNES/Debugger/DummySnesCpu.h"
+#include "SNES/Debugger/DummySpc.h"
+#include "Gameboy/Debugger/DummyGbCpu.h"
+#include "PCE/Debugger/DummyPceCpu.h"
+#include "Utilities/JsonParser.h"
+#include "Utilities/FolderUtilities.h"
+#include "Utilities/magic_enum.hpp"
+
+static void CompareValue(string& error, const char* name, int64_t actual, const JsonValue& expected, int64_t mask = -1)
+{
+	if(error.empty() && !expected.IsNull() && (actual & mask) != (expected.GetInt() & mask)) {
+		error = string(name) + ": expected " + std::to_string(expected.GetInt() & mask) + ", got " + std::to_string(actual & mask);
+	}
+}
+
+class NesCpuTestCore final : public ICpuTestCore
+{
+private:
+	unique_ptr<NesConsole> _console;
+	unique_ptr<DummyNesCpu> _cpu;
+	NesCpuState _state = {};
+
+public:
+	NesCpuTestCore(Emulator* emu, CpuTestBus& bus)
+	{
+		_console.reset(new NesConsole(emu));
+		_cpu.reset(new DummyNesCpu(_console.get()));
+		_cpu->SetTestBus(&bus);
+	}
+
+	uint32_t LoadState(const JsonValue& state) override
+	{
+		_state = {};
+		_state.PC = (uint16_t)state["pc"].GetInt();
+		_state.SP = (uint8_t)state["s"].GetInt();
+		_state.A = (uint8_t)state["a"].GetInt();
+		_state.X = (uint8_t)state["x"].GetInt();
+		_state.Y = (uint8_t)state["y"].GetInt();
+		_state.PS = (uint8_t)state["p"].GetInt() & 0xCF;
+		ResetState();
+		return _state.PC;
+	}
+
+	void ResetState() override { _cpu->SetDummyState(_state); }
+	void Exec() override { _cpu->Exec(); }
+
+	string CompareState(const JsonValue& state) override
+	{
+		//The break/reserved flags don't exist in the CPU's status register
+		NesCpuState& cpu = _cpu->GetState();
+		string error;
+		CompareValue(error, "pc", cpu.PC, state["pc"]);
+		CompareValue(error, "s", cpu.SP, state["s"]);
+		CompareValue(error, "a", cpu.A, state["a"]);
+		CompareValue(error, "x", cpu.X, state["x"]);
+		CompareValue(error, "y", cpu.Y, state["y"]);
+		CompareValue(error, "p", cpu.PS, state["p"], 0xCF);
+		return error;
+	}
+};
+
+class SnesCpuTestCore final : public ICpuTestCore
+{
+private:
+	unique_ptr<DummySnesCpu> _cpu;
+	SnesCpuState _state = {};
+
+public:
+	SnesCpuTestCore(CpuTestBus& bus)
+	{
+		_cpu.reset(new DummySnesCpu(&bus));
+	}
+
+	uint32_t LoadState(const JsonValue& state) override
+	{
+		_state = {};
+		_state.PC = (uint16_t)state["pc"].GetInt();
+		_state.SP = (uint16_t)state["s"].GetInt();
+		_state.A = (uint16_t)state["a"].GetInt();
+		_state.X = (uint16_t)state["x"].GetInt();
+		_state.Y = (uint16_t)state["y"].GetInt();
+		_state.D = (uint16_t)state["d"].GetInt();
+		_state.K = (uint8_t)state["pbr"].GetInt();
+		_state.DBR = (uint8_t)state["dbr"].GetInt();
+		_state.PS = (uint8_t)state["p"].GetInt();
+		_state.EmulationMode = state["e"].GetInt() != 0;
+		ResetState();
+		return (_state.K << 16) | _state.PC;
+	}
+
+	void ResetState() override { _cpu->SetDummyState(_state); }
+	void Exec() override { _cpu->Exec(); }
+
+	string CompareState(const JsonValue& state) override
+	{
+		SnesCpuState& cpu = _cpu->GetState();
+		string error;
+		CompareValue(error, "pc", cpu.PC, state["pc"]);
+		CompareValue(error, "s", cpu.SP, state["s"]);
+		CompareValue(error, "a", cpu.A, state["a"]);
+		CompareValue(error, "x", cpu.X, state["x"]);
+		CompareValue(error, "y", cpu.Y, state["y"]);
+		CompareValue(error, "d", cpu.D, state["d"]);
+		CompareValue(error, "pbr", cpu.K, state["pbr"]);
+		CompareValue(error, "dbr", cpu.DBR, state["dbr"]);
+		CompareValue(error, "p", cpu.PS, state["p"]);
+		CompareValue(error, "e", cpu.EmulationMode ? 1 : 0, state["e"]);
+		return error;
+	}
+};
+
+class SpcTestCore final : public ICpuTestCore
+{
+private:
+	unique_ptr<DummySpc> _cpu;
+	SpcState _state = {};
+
+public:
+	SpcTestCore(CpuTestBus& bus)
+	{
+		_cpu.reset(new DummySpc(bus.Ram.data()));
+		_cpu->SetTestBus(&bus);
+	}
+
+	uint32_t LoadState(const JsonValue& state) override
+	{
+		_state = {};
+		_state.PC = (uint16_t)state["pc"].GetInt();
+		_state.SP = (uint8_t)state["sp"].GetInt();
+		_state.A = (uint8_t)state["a"].GetInt();
+		_state.X = (uint8_t)state["x"].GetInt();
+		_state.Y = (uint8_t)state["y"].GetInt();
+		_state.PS = (uint8_t)state["psw"].GetInt();
+		_state.StopState = SnesCpuStopState::Running;
+		ResetState();
+		return _state.PC;
+	}
+
+	void ResetState() override { _cpu->SetDummyState(_state); }
+	void Exec() override { _cpu->Step(); }
+
+	string CompareState(const JsonValue& state) override
+	{
+		SpcState& cpu = _cpu->GetState();
+		string error;
+		CompareValue(error, "pc", cpu.PC, state["pc"]);
+		CompareValue(error, "sp", cpu.SP, state["sp"]);
+		CompareValue(error, "a", cpu.A, state["a"]);
+		CompareValue(error, "x", cpu.X, state["x"]);
+		CompareValue(error, "y", cpu.Y, state["y"]);
+		CompareValue(error, "psw", cpu.PS, state["psw"]);
+		return error;
+	}
+};
+
+class GbCpuTestCore final : public ICpuTestCore
+{
+private:
+	unique_ptr<DummyGbCpu> _cpu;
+	GbCpuState _state = {};
+
+public:
+	GbCpuTestCore(Emulator* emu, CpuTestBus& bus)
+	{
+		_cpu.reset(new DummyGbCpu());
+		_cpu->Init(emu, nullptr, nullptr);
+		_cpu->SetTestBus(&bus);
+	}
+
+	uint32_t LoadState(const JsonValue& state) override
+	{
+		_state = {};
+		_state.PC = (uint16_t)state["pc"].GetInt();
+		_state.SP = (uint16_t)state["sp"].GetInt();
+		_state.A = (uint8_t)state["a"].GetInt();
+		_state.Flags = (uint8_t)state["f"].GetInt();
+		_state.B = (uint8_t)state["b"].GetInt();
+		_state.C = (uint8_t)state["c"].GetInt();
+		_state.D = (uint8_t)state["d"].GetInt();
+		_state.E = (uint8_t)state["e"].GetInt();
+		_state.H = (uint8_t)state["h"].GetInt();
+		_state.L = (uint8_t)state["l"].GetInt();
+		_state.IME = state["ime"].GetInt() != 0;
+		ResetState();
+		return _state.PC;
+	}
+
+	void ResetState() override { _cpu->SetDummyState(_state); }
+	void Exec() override { _cpu->Exec(); }
+
+	string CompareState(const JsonValue& state) override
+	{
+		GbCpuState& cpu = _cpu->GetState();
+		string error;
+		CompareValue(error, "pc", cpu.PC, state["pc"]);
+		CompareValue(error, "sp", cpu.SP, state["sp"]);
+		CompareValue(error, "a", cpu.A, state["a"]);
+		CompareValue(error, "f", cpu.Flags, state["f"]);
+		CompareValue(error, "b", cpu.B, state["b"]);
+		CompareValue(error, "c", cpu.C, state["c"]);
+		CompareValue(error, "d", cpu.D, state["d"]);
+		CompareValue(error, "e", cpu.E, state["e"]);
+		CompareValue(error, "h", cpu.H, state["h"]);
+		CompareValue(error, "l", cpu.L, state["l"]);
+		CompareValue(error, "ime", cpu.IME ? 1 : 0, state["ime"]);
+		return error;
+	}
+
+	bool IsSkipped(uint8_t opCode) override
+	{
+		//STOP & HALT depend on the memory manager's IRQ/speed switch state
+		return opCode == 0x10 || opCode == 0x76;
+	}
+};
+
+class PceCpuTestCore final : public ICpuTestCore
+{
+private:
+	unique_ptr<DummyPceCpu> _cpu;
+	PceCpuState _state = {};
+
+public:
+	PceCpuTestCore(Emulator* emu, CpuTestBus& bus)
+	{
+		_cpu.reset(new DummyPceCpu(emu, nullptr));
+		_cpu->SetTestBus(&bus);
+	}
+
+	uint32_t LoadState(const JsonValue& state) override
+	{
+		_state = {};
+		_state.PC = (uint16_t)state["pc"].GetInt();
+		_state.SP = (uint8_t)state["s"].GetInt();
+		_state.A = (uint8_t)state["a"].GetInt();
+		_state.X = (uint8_t)state["x"].GetInt();
+		_state.Y = (uint8_t)state["y"].GetInt();
+		_state.PS = (uint8_t)state["p"].GetInt();
+		ResetState();
+		return _state.PC;
+	}
+
+	void ResetState() override { _cpu->SetDummyState(_state); }
+	void Exec() override { _cpu->Exec(); }
+
+	string CompareState(const JsonValue& state) override
+	{
+		PceCpuState& cpu = _cpu->GetState();
+		string error;
+		CompareValue(error, "pc", cpu.PC, state["pc"]);
+		CompareValue(error, "s", cpu.SP, state["s"]);
+		CompareValue(error, "a", cpu.A, state["a"]);
+		CompareValue(error, "x", cpu.X, state["x"]);
+		CompareValue(error, "y", cpu.Y, state["y"]);
+		CompareValue(error, "p", cpu.PS, state["p"], 0xEF);
+		return error;
+	}
+
+	bool IsSkipped(uint8_t opCode) override
+	{
+		//ST0/ST1/ST2 write to the VDC, TMA/TAM access the MPRs (the test bus has no mapping)
+		return opCode == 0x03 || opCode == 0x13 || opCode == 0x23 || opCode == 0x43 || opCode == 0x53;
+	}
+};
+
+CpuTestRunner::CpuTestRunner(Emulator* emu, uint32_t iterations)
+{
+	_emu = emu;
+	_iterations = iterations;
+}
+
+uint32_t CpuTestRunner::GetBusSize(CpuType cpuType)
+{
+	return cpuType == CpuType::Snes ? 0x1000000 : 0x10000;
+}
+
+unique_ptr<ICpuTestCore> CpuTestRunner::CreateCore(CpuType cpuType, CpuTestBus& bus)
+{
+	switch(cpuType) {
+		case CpuType::Nes: return unique_ptr<ICpuTestCore>(new NesCpuTestCore(_emu, bus));
+		case CpuType::Snes: return unique_ptr<ICpuTestCore>(new SnesCpuTestCore(bus));
+		case CpuType::Spc: return unique_ptr<ICpuTestCore>(new SpcTestCore(bus));
+		case CpuType::Gameboy: return unique_ptr<ICpuTestCore>(new GbCpuTestCore(_emu, bus));
+		case CpuType::Pce: return unique_ptr<ICpuTestCore>(new PceCpuTestCore(_emu, bus));
+		default: return nullptr;
+	}
+}
+
+void CpuTestRunner::LoadRam(CpuTestBus& bus, const JsonValue& state)
+{
+	for(const JsonValue& entry : state["ram"].Items) {
+		bus.Ram[entry[0].GetInt() & bus.AddressMask] = (uint8_t)entry[1].GetInt();
+	}
+}
+
+void CpuTestRunner::ClearRam(CpuTestBus& bus, const JsonValue& test)
+{
+	for(const JsonValue& entry : test["initial"]["ram"].Items) {
+		bus.Ram[entry[0].GetInt() & bus.AddressMask] = 0;
+	}
+	for(const JsonValue& entry : test["final"]["ram"].Items) {
+		bus.Ram[entry[0].GetInt() & bus.AddressMask] = 0;
+	}
+	for(MemoryOperationInfo& op : bus.Operations) {
+		bus.Ram[op.Address] = 0;
+	}
+	bus.Operations.clear();
+}
+
+string CpuTestRunner::CompareRam(CpuTestBus& bus, const JsonValue& state)
+{
+	for(const JsonValue& entry : state["ram"].Items) {
+		uint32_t addr = (uint32_t)entry[0].GetInt() & bus.AddressMask;
+		uint8_t expected = (uint8_t)entry[1].GetInt();
+		if(bus.Ram[addr] != expected) {
+			return "RAM[" + std::to_string(addr) + "]: expected " + std::to_string(expected) + ", got " + std::to_string(bus.Ram[addr]);
+		}
+	}
+	return "";
+}
+
+string CpuTestRunner::CompareBusOperations(CpuTestBus& bus, const JsonValue& cycles)
+{
+	struct ExpectedOperation
+	{
+		const JsonValue* Address;
+		const JsonValue* Value;
+		bool IsWrite;
+	};
+
+	vector<ExpectedOperation> expected;
+	for(const JsonValue& cycle : cycles.Items) {
+		const string& type = cycle[2].StringValue;
+		bool isRead;
+		bool isWrite;
+		if(type == "read" || type == "write" || type == "wait") {
+			isRead = type == "read";
+			isWrite = type == "write";
+		} else if(type.size() == 3) {
+			//SM83 format ("r-m", "-wm", "---")
+			isRead = type[0] == 'r';
+			isWrite = type[1] == 'w';
+		} else {
+			//Unknown format, only compare the final state
+			return "";
+		}
+
+		if(isRead || isWrite) {
+			expected.push_back({ &cycle[0], &cycle[1], isWrite });
+		}
+	}
+
+	if(expected.size() != bus.Operations.size()) {
+		return "Bus operation count: expected " + std::to_string(expected.size()) + ", got " + std::to_string(bus.Operations.size());
+	}
+
+	for(size_t i = 0; i < expected.size(); i++) {
+		MemoryOperationInfo& op = bus.Operations[i];
+		bool isWrite = op.Type == MemoryOperationType::Write || op.Type == MemoryOperationType::DummyWrite;
+		bool match = (
+			isWrite == expected[i].IsWrite &&
+			(expected[i].Address->IsNull() || op.Address == (expected[i].Address->GetInt() & bus.AddressMask)) &&
+			(expected[i].Value->IsNull() || op.Value == expected[i].Value->GetInt())
+		);
+
+		if(!match) {
+			return "Bus operation #" + std::to_string(i) + ": expected " + (expected[i].IsWrite ? "write " : "read ") +
+				std::to_string(expected[i].Address->GetInt()) + " = " + std::to_string(expected[i].Value->GetInt()) +
+				", got " + (isWrite ? "write " : "read ") + std::to_string(op.Address) + " = " + std::to_string(op.Value);
+		}
+	}
+	return "";
+}
+
+void CpuTestRunner::RunFile(ICpuTestCore* core, CpuTestBus& bus, const JsonValue& tests, CpuTestFileResult& result)
+{
+	uint64_t totalTime = 0;
+	uint64_t timedOps = 0;
+
+	for(const JsonValue& test : tests.Items) {
+		const JsonValue& initial = test["initial"];
+		result.TestCount++;
+
+		LoadRam(bus, initial);
+		uint32_t opAddr = core->LoadState(initial);
+		if(core->IsSkipped(bus.Ram[opAddr & bus.AddressMask])) {
+			result.Skipped++;
+			ClearRam(bus, test);
+			continue;
+		}
+
+		bus.Operations.clear();
+		core->Exec();
+
+		string error = core->CompareState(test["final"]);
+		if(error.empty()) {
+			error = CompareRam(bus, test["final"]);
+		}
+		if(error.empty()) {
+			error = CompareBusOperations(bus, test["cycles"]);
+		}
+
+		if(error.empty()) {
+			result.Passed++;
+		} else {
+			result.Failed++;
+			if(result.FirstFailure.empty()) {
+				result.FirstFailure = test["name"].StringValue + " - " + error;
+			}
+		}
+
+		if(_iterations > 0) {
+			//Run the instruction repeatedly (from the same initial register state) and
+			//subtract the time taken by the state reset itself
+			auto start = std::chrono::high_resolution_clock::now();
+			for(uint32_t i = 0; i < _iterations; i++) {
+				core->ResetState();
+				bus.Operations.clear();
+				core->Exec();
+			}
+			auto execEnd = std::chrono::high_resolution_clock::now();
+			for(uint32_t i = 0; i < _iterations; i++) {
+				core->ResetState();
+				bus.Operations.clear();
+			}
+			auto resetEnd = std::chrono::high_resolution_clock::now();
+
+			int64_t execTime = std::chrono::duration_cast<std::chrono::nanoseconds>(execEnd - start).count();
+			int64_t resetTime = std::chrono::duration_cast<std::chrono::nanoseconds>(resetEnd - execEnd).count();
+			totalTime += std::max<int64_t>(execTime - resetTime, 0);
+			timedOps += _iterations;
+		}
+
+		ClearRam(bus, test);
+	}
+
+	result.NsPerOp = timedOps > 0 ? (double)totalTime / timedOps : 0;
+}
+
+vector<CpuTestFileResult> CpuTestRunner::Run(CpuType cpuType, string folder)
+{
+	vector<CpuTestFileResult> results;
+
+	CpuTestBus bus(GetBusSize(cpuType));
+	unique_ptr<ICpuTestCore> core = CreateCore(cpuType, bus);
+	if(!core) {
+		return results;
+	}
+
+	vector<string> files = FolderUtilities::GetFilesInFolder(folder, { ".json" }, false);
+	std::sort(files.begin(), files.end());
+
+	for(string& file : files) {
+		CpuTestFileResult result;
+		result.Name = FolderUtilities::GetFilename(file, false);
+
+		JsonValue tests;
+		string error;
+		if(!JsonParser::ParseFile(file, tests, error)) {
+			result.FirstFailure = "Invalid file: " + error;
+		} else {
+			RunFile(core.get(), bus, tests, result);
+		}
+
+		results.push_back(std::move(result));
+	}
+
+	return results;
+}
+
+string CpuTestRunner::ToJson(CpuType cpuType, vector<CpuTestFileResult>& results)
+{
+	auto getJsonString = [](const string& value) {
+		string result = "\"";
+		for(char c : value) {
+			if(c == '"' || c == '\\') {
+				result += '\\';
+			}
+			result += c;
+		}
+		return result + "\"";
+	};
+
+	uint32_t total = 0;
+	uint32_t passed = 0;
+	uint32_t failed = 0;
+	uint32_t skipped = 0;
+
+	std::stringstream json;
+	json << "{\n\t\"cpu\": " << getJsonString(string(magic_enum::enum_name(cpuType))) << ",\n\t\"results\": [";
+	for(size_t i = 0; i < results.size(); i++) {
+		CpuTestFileResult& result = results[i];
+		json << (i > 0 ? "," : "") << "\n\t\t{";
+		json << "\"name\": " << getJsonString(result.Name) << ", ";
+		json << "\"tests\": " << result.TestCount << ", ";
+		json << "\"passed\": " << result.Passed << ", ";
+		json << "\"failed\": " << result.Failed << ", ";
+		json << "\"skipped\": " << result.Skipped << ", ";
+		json << "\"nsPerOp\": " << result.NsPerOp << ", ";
+		json << "\"firstFailure\": " << getJsonString(result.FirstFailure);
+		json << "}";
+
+		total += result.TestCount;
+		passed += result.Passed;
+		failed += result.Failed;
+		skipped += result.Skipped;
+	}
+	json << "\n\t],\n";
+	json << "\t\"total\": " << total << ",\n";
+	json << "\t\"passed\": " << passed << ",\n";
+	json << "\t\"failed\": " << failed << ",\n";
+	json << "\t\"skipped\": " << skipped << "\n}\n";
+	return json.str();
+}
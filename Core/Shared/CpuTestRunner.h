@@ -0,0 +1,69 @@
+#pragma once
+#include "pch.h"
+#include "Shared/CpuType.h"
+
+class Emulator;
+class JsonValue;
+struct CpuTestBus;
+
+struct CpuTestFileResult
+{
+	string Name;
+	uint32_t TestCount = 0;
+	uint32_t Passed = 0;
+	uint32_t Failed = 0;
+	uint32_t Skipped = 0;
+	double NsPerOp = 0;
+	string FirstFailure;
+};
+
+class ICpuTestCore
+{
+public:
+	virtual ~ICpuTestCore() {}
+
+	//Loads the test's initial register values, returns the address of the opcode
+	virtual uint32_t LoadState(const JsonValue& state) = 0;
+
+	//Restores the state set by the last LoadState call
+	virtual void ResetState() = 0;
+
+	virtual void Exec() = 0;
+
+	//Returns a description of the first register that doesn't match the test's final state (or an empty string)
+	virtual string CompareState(const JsonValue& state) = 0;
+
+	//Instructions that depend on hardware outside the CPU (e.g MPR/VDC registers, IRQ lines) can't run on the test bus
+	virtual bool IsSkipped(uint8_t opCode) { return false; }
+};
+
+//Runs the CPU cores (through their dummy variants, which are built from the same source) against
+//single-step test vectors: one JSON file per opcode, each containing an array of tests with the
+//following format (SingleStepTests-style):
+//  { "name": "...", "initial": { <registers>, "ram": [[addr, value], ...] }, "final": { ... }, "cycles": [[addr, value, "read"|"write"], ...] }
+//Register names: pc, s/sp, a, x, y, p/psw (+ dbr, d, pbr, e for 65816, b, c, d, e, f, h, l for SM83)
+//Also measures the average execution time of each opcode.
+class CpuTestRunner
+{
+private:
+	Emulator* _emu;
+	uint32_t _iterations;
+
+	unique_ptr<ICpuTestCore> CreateCore(CpuType cpuType, CpuTestBus& bus);
+	uint32_t GetBusSize(CpuType cpuType);
+
+	void LoadRam(CpuTestBus& bus, const JsonValue& state);
+	string CompareRam(CpuTestBus& bus, const JsonValue& state);
+	string CompareBusOperations(CpuTestBus& bus, const JsonValue& cycles);
+	void ClearRam(CpuTestBus& bus, const JsonValue& test);
+
+	void RunFile(ICpuTestCore* core, CpuTestBus& bus, const JsonValue& tests, CpuTestFileResult& result);
+
+public:
+	CpuTestRunner(Emulator* emu, uint32_t iterations);
+
+	//Runs all test files (*.json) in the folder
+	vector<CpuTestFileResult> Run(CpuType cpuType, string folder);
+
+	static string ToJson(CpuType cpuType, vector<CpuTestFileResult>& results);
+};
@@ -24,6 +24,7 @@
 #include "Shared/Movies/MovieManager.h"
 #include "Shared/TimingInfo.h"
 #include "Shared/HistoryViewer.h"
+#include "Shared/RomLibraryIndex.h"
 #include "Netplay/GameServer.h"
 #include "Netplay/GameClient.h"
 #include "Shared/Interfaces/IConsole.h"
@@ -61,6 +62,7 @@ Emulator::Emulator() :
 	_cheatManager(new CheatManager(this)),
 	_movieManager(new MovieManager(this)),
 	_historyViewer(new HistoryViewer(this)),
+	_romLibraryIndex(new RomLibraryIndex()),
 	_gameServer(new GameServer(this)),
 	_gameClient(new GameClient(this)),
 	_rewindManager(new RewindManager(this))
@@ -100,6 +102,7 @@ void Emulator::Release()
 
 	_gameClient->Disconnect();
 	_gameServer->StopServer();
+	_romLibraryIndex->Stop();
 
 	_videoDecoder->StopThread();
 	_videoRenderer->StopThread();
@@ -129,6 +132,7 @@ void Emulator::Run()
 	_stats.reset(new DebugStats());
 	_frameLimiter.reset(new FrameLimiter(_frameDelay));
 	_lastFrameTimer.Reset();
+	_frameCostTimer.Reset();
 
 	while(!_stopFlag) {
 		bool useRunAhead = _settings->GetEmulationConfig().RunAheadFrames > 0 && !_debugger && !_audioPlayerHud && !_rewindManager->IsRewinding() && _settings->GetEmulationSpeed() > 0 && _settings->GetEmulationSpeed() <= 100;
@@ -138,6 +142,7 @@ void Emulator::Run()
 			_console->RunFrame();
 			_rewindManager->ProcessEndOfFrame();
 			_historyViewer->ProcessEndOfFrame();
+			_movieManager->ProcessEndOfFrame();
 			ProcessSystemActions();
 		}
 
@@ -219,6 +224,7 @@ void Emulator::RunFrameWithRunAhead()
 	_console->RunFrame();
 	_rewindManager->ProcessEndOfFrame();
 	_historyViewer->ProcessEndOfFrame();
+	_movieManager->ProcessEndOfFrame();
 
 	bool wasReset = ProcessSystemActions();
 	if(!wasReset) {
@@ -247,13 +253,20 @@ void Emulator::OnBeforeSendFrame()
 void Emulator::ProcessEndOfFrame()
 {
 	if(!_isRunAheadFrame) {
+		//Frame delay is only used at normal speed (or slower) - it has no effect when the frame limiter isn't sleeping
+		uint32_t emulationSpeed = _settings->GetEmulationSpeed();
+		bool useFrameDelay = _settings->GetEmulationConfig().AutoFrameDelay && emulationSpeed > 0 && emulationSpeed <= 100 && !_debugger && !_rewindManager->IsRewinding();
+		_stats->AddFrameCost(_frameCostTimer.GetElapsedMS());
+
 		_frameLimiter->ProcessFrame();
+		_frameLimiter->UpdateFrameDelay(useFrameDelay, _stats->GetFrameCostEstimate());
 		while(_frameLimiter->WaitForNextFrame()) {
 			if(_stopFlag || _frameDelay != GetFrameDelay() || _paused || _pauseOnNextFrame || _lockCounter > 0) {
 				//Need to process another event, stop sleeping
 				break;
 			}
 		}
+		_frameCostTimer.Reset();
 
 		double newFrameDelay = GetFrameDelay();
 		if(newFrameDelay != _frameDelay) {
@@ -402,6 +415,7 @@ bool Emulator::LoadRom(VirtualFile romFile, VirtualFile patchFile, bool stopRom,
 		MessageManager::DisplayMessage("Error", "CouldNotLoadFile", romFile.GetFileName());
 		if(debugger) {
 			_debugger.reset(debugger);
+			UpdateInstrumentation();
 			debugger->ResetSuspendCounter();
 		}
 		_blockDebuggerRequestCount--;
@@ -700,6 +714,12 @@ double Emulator::GetFps()
 	return fps;
 }
 
+FrameDelayStats Emulator::GetFrameDelayStats()
+{
+	FrameLimiter* frameLimiter = _frameLimiter.get();
+	return frameLimiter ? frameLimiter->GetFrameDelayStats() : FrameDelayStats {};
+}
+
 double Emulator::GetFrameDelay()
 {
 	uint32_t emulationSpeed = _settings->GetEmulationSpeed();
@@ -946,13 +966,20 @@ void Emulator::ResetDebugger(bool startDebugger)
 
 	if(_emulationThreadId == std::this_thread::get_id()) {
 		_debugger.reset(startDebugger ? new Debugger(this, _console.get()) : nullptr);
+		UpdateInstrumentation();
 	} else {
 		//Need to pause emulator to change _debugger (when not called from the emulation thread)
 		auto emuLock = AcquireLock();
 		_debugger.reset(startDebugger ? new Debugger(this, _console.get()) : nullptr);
+		UpdateInstrumentation();
 	}
 }
 
+void Emulator::UpdateInstrumentation()
+{
+	_instrumentation = (_debugger ? InstrumentationFlags::Debugger : 0) | (_cheatManager->HasCheats() ? InstrumentationFlags::Cheats : 0);
+}
+
 void Emulator::InitDebugger()
 {
 	if(!_debugger) {
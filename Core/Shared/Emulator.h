@@ -24,7 +24,9 @@ class BatteryManager;
 class CheatManager;
 class MovieManager;
 class HistoryViewer;
+class RomLibraryIndex;
 class FrameLimiter;
+struct FrameDelayStats;
 class DebugStats;
 class BaseControlManager;
 class VirtualFile;
@@ -55,6 +57,15 @@ struct ConsoleMemoryInfo
 	uint32_t Size;
 };
 
+namespace InstrumentationFlags
+{
+	enum InstrumentationFlags : uint8_t
+	{
+		Debugger = 0x01,
+		Cheats = 0x02
+	};
+}
+
 class Emulator
 {
 private:
@@ -69,6 +80,10 @@ private:
 	safe_ptr<Debugger> _debugger;
 	shared_ptr<SystemActionManager> _systemActionManager;
 
+	//InstrumentationFlags for the features that need to see memory accesses/instructions/etc.
+	//Every debugger hook tests this byte, and the memory read paths skip both cheats and the debugger when it is 0
+	uint8_t _instrumentation = 0;
+
 	const unique_ptr<EmuSettings> _settings;
 	const unique_ptr<DebugHud> _debugHud;
 	const unique_ptr<DebugHud> _scriptHud;
@@ -81,6 +96,7 @@ private:
 	const unique_ptr<CheatManager> _cheatManager;
 	const unique_ptr<MovieManager> _movieManager;
 	const unique_ptr<HistoryViewer> _historyViewer;
+	const unique_ptr<RomLibraryIndex> _romLibraryIndex;
 	
 	const shared_ptr<GameServer> _gameServer;
 	const shared_ptr<GameClient> _gameClient;
@@ -111,6 +127,7 @@ private:
 	unique_ptr<DebugStats> _stats;
 	unique_ptr<FrameLimiter> _frameLimiter;
 	Timer _lastFrameTimer;
+	Timer _frameCostTimer;
 	double _frameDelay = 0;
 	
 	uint32_t _autoSaveStateFrameCounter = 0;
@@ -191,6 +208,7 @@ public:
 	BatteryManager* GetBatteryManager() { return _batteryManager.get(); }
 	CheatManager* GetCheatManager() { return _cheatManager.get(); }
 	MovieManager* GetMovieManager() { return _movieManager.get(); }
+	RomLibraryIndex* GetRomLibraryIndex() { return _romLibraryIndex.get(); }
 	HistoryViewer* GetHistoryViewer() { return _historyViewer.get(); }
 	GameServer* GetGameServer() { return _gameServer.get(); }
 	GameClient* GetGameClient() { return _gameClient.get(); }
@@ -208,6 +226,8 @@ public:
 	void StopDebugger();
 	DebuggerRequest GetDebugger(bool autoInit = false);
 	bool IsDebugging() { return !!_debugger; }
+	__forceinline uint8_t GetInstrumentation() { return _instrumentation; }
+	void UpdateInstrumentation();
 	Debugger* InternalGetDebugger() { return _debugger.get(); }
 
 	thread::id GetEmulationThreadId() { return _emulationThreadId; }
@@ -227,6 +247,7 @@ public:
 	bool IsRunAheadFrame() { return _isRunAheadFrame; }
 
 	TimingInfo GetTimingInfo(CpuType cpuType);
+	FrameDelayStats GetFrameDelayStats();
 	uint32_t GetFrameCount();
 
 	uint32_t GetLagCounter();
@@ -241,21 +262,29 @@ public:
 	
 	template<CpuType type> __forceinline void ProcessInstruction()
 	{
-		if(_debugger) {
+		if(_instrumentation & InstrumentationFlags::Debugger) {
 			_debugger->ProcessInstruction<type>();
 		}
 	}
 
 	template<CpuType type, typename T> __forceinline void ProcessMemoryRead(uint32_t addr, T& value, MemoryOperationType opType)
 	{
-		if(_debugger) {
+		if(_instrumentation & InstrumentationFlags::Debugger) {
+			_debugger->ProcessMemoryRead<type>(addr, value, opType);
+		}
+	}
+
+	//Used by the memory read paths once they've loaded GetInstrumentation() (avoids reading the flags again after applying cheats)
+	template<CpuType type, typename T> __forceinline void ProcessMemoryRead(uint8_t instrumentation, uint32_t addr, T& value, MemoryOperationType opType)
+	{
+		if(instrumentation & InstrumentationFlags::Debugger) {
 			_debugger->ProcessMemoryRead<type>(addr, value, opType);
 		}
 	}
 
 	template<CpuType type, typename T> __forceinline bool ProcessMemoryWrite(uint32_t addr, T& value, MemoryOperationType opType)
 	{
-		if(_debugger) {
+		if(_instrumentation & InstrumentationFlags::Debugger) {
 			return _debugger->ProcessMemoryWrite<type>(addr, value, opType);
 		}
 		return true;
@@ -263,42 +292,42 @@ public:
 
 	template<CpuType type> __forceinline void ProcessIdleCycle()
 	{
-		if(_debugger) {
+		if(_instrumentation & InstrumentationFlags::Debugger) {
 			_debugger->ProcessIdleCycle<type>();
 		}
 	}
 
 	template<CpuType type> __forceinline void ProcessHaltedCpu()
 	{
-		if(_debugger) {
+		if(_instrumentation & InstrumentationFlags::Debugger) {
 			_debugger->ProcessHaltedCpu<type>();
 		}
 	}
 
 	template<CpuType type, typename T> __forceinline void ProcessPpuRead(uint32_t addr, T& value, MemoryType memoryType, MemoryOperationType opType = MemoryOperationType::Read)
 	{
-		if(_debugger) {
+		if(_instrumentation & InstrumentationFlags::Debugger) {
 			_debugger->ProcessPpuRead<type>(addr, value, memoryType, opType);
 		}
 	}
 
 	template<CpuType type, typename T> __forceinline void ProcessPpuWrite(uint32_t addr, T& value, MemoryType memoryType)
 	{
-		if(_debugger) {
+		if(_instrumentation & InstrumentationFlags::Debugger) {
 			_debugger->ProcessPpuWrite<type>(addr, value, memoryType);
 		}
 	}
 
 	template<CpuType type> __forceinline void ProcessPpuCycle()
 	{
-		if(_debugger) {
+		if(_instrumentation & InstrumentationFlags::Debugger) {
 			_debugger->ProcessPpuCycle<type>();
 		}
 	}
 
 	__forceinline void DebugLog(string log)
 	{
-		if(_debugger) {
+		if(_instrumentation & InstrumentationFlags::Debugger) {
 			_debugger->Log(log);
 		}
 	}
@@ -1,14 +1,43 @@
 #pragma once
 #include "Utilities/Timer.h"
 
+struct FrameDelayStats
+{
+	bool Enabled;
+
+	//Time spent waiting after each frame's scheduled start, before emulating it
+	double FrameDelay;
+
+	//Estimated time needed to emulate a frame (based on the recent frames)
+	double FrameCost;
+
+	//Average time between the start of a frame (when input is polled) and its deadline/completion
+	double AverageLatency;
+
+	//Number of frames that completed after their deadline while the frame delay was active
+	uint32_t MissedFrames;
+};
+
 class FrameLimiter
 {
 private:
+	//Safety margin kept between the end of a frame and its deadline
+	static constexpr double FrameDelayMargin = 2.0;
+
 	Timer _clockTimer;
 	double _targetTime;
 	double _delay;
 	bool _resetRunTimers;
 
+	bool _frameDelayEnabled = false;
+	double _frameDelay = 0;
+	double _frameDelayBackoff = 0;
+	double _frameCost = 0;
+	double _frameStartTime = 0;
+	double _latencies[60] = {};
+	uint32_t _latencyIndex = 0;
+	uint32_t _missedFrames = 0;
+
 public:
 	FrameLimiter(double delay)
 	{
@@ -33,21 +62,79 @@ public:
 			//   This can happen when something slows the emulator down severely (or when breaking execution in VS when debugging Mesen itself, etc.)
 			_clockTimer.Reset();
 			_targetTime = 0;
+			_frameStartTime = 0;
 			_resetRunTimers = false;
 		}
 
 		_targetTime += _delay;
+
+		if(_frameDelayEnabled) {
+			//The frame that just ended was due at _targetTime
+			double now = _clockTimer.GetElapsedMS();
+			if(now > _targetTime) {
+				//Missed the deadline, start the next frames earlier
+				_missedFrames++;
+				_frameDelayBackoff = std::min(_frameDelayBackoff + 1.0, _delay);
+			} else {
+				_frameDelayBackoff = std::max(_frameDelayBackoff - 0.01, 0.0);
+			}
+
+			_latencies[_latencyIndex] = std::max(now, _targetTime) - _frameStartTime;
+			_latencyIndex = (_latencyIndex + 1) % 60;
+		}
+	}
+
+	//Adaptive frame delay: wait after each frame's scheduled start so that the frame (and the input polling it does)
+	//runs as late as possible, while still finishing before the frame's deadline
+	void UpdateFrameDelay(bool enabled, double frameCost)
+	{
+		if(enabled != _frameDelayEnabled) {
+			_frameDelayEnabled = enabled;
+			_frameDelayBackoff = 0;
+			_missedFrames = 0;
+			_latencyIndex = 0;
+			std::fill(std::begin(_latencies), std::end(_latencies), 0.0);
+		}
+
+		_frameCost = frameCost;
+		if(enabled) {
+			_frameDelay = std::clamp(_delay - frameCost - FrameDelayMargin - _frameDelayBackoff, 0.0, _delay * 0.9);
+		} else {
+			_frameDelay = 0;
+		}
+	}
+
+	FrameDelayStats GetFrameDelayStats()
+	{
+		FrameDelayStats stats = {};
+		stats.Enabled = _frameDelayEnabled;
+		stats.FrameDelay = _frameDelay;
+		stats.FrameCost = _frameCost;
+		stats.MissedFrames = _missedFrames;
+
+		double totalLatency = 0;
+		uint32_t count = 0;
+		for(double latency : _latencies) {
+			if(latency > 0) {
+				totalLatency += latency;
+				count++;
+			}
+		}
+		stats.AverageLatency = count > 0 ? totalLatency / count : 0;
+		return stats;
 	}
 
 	bool WaitForNextFrame()
 	{
-		if(_targetTime - _clockTimer.GetElapsedMS() > 50) {
+		double startTime = _targetTime + _frameDelay;
+		if(startTime - _clockTimer.GetElapsedMS() > 50) {
 			//When sleeping for a long time (e.g <= 25% speed), sleep in small chunks and check to see if we need to stop sleeping between each sleep call
 			_clockTimer.WaitUntil(_clockTimer.GetElapsedMS() + 40);
 			return true;
 		}
 
-		_clockTimer.WaitUntil(_targetTime);
+		_clockTimer.WaitUntil(startTime);
+		_frameStartTime = _clockTimer.GetElapsedMS();
 		return false;
 	}
-};
\ No newline at end of file
+};
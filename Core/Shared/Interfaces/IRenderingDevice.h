@@ -11,6 +11,12 @@ struct RenderSurfaceInfo
 	uint32_t Width = 0;
 	uint32_t Height = 0;
 
+	//Area that contains the pixels drawn since the last clear (the rest of the surface is transparent)
+	HudDirtyRect DrawnRect;
+
+	//Area modified (drawn or cleared) since the rendering device last uploaded the surface - the device resets it after uploading
+	HudDirtyRect ChangedRect;
+
 	void UpdateSize(uint32_t width, uint32_t height)
 	{
 		if(Width != width || Height != height) {
@@ -18,13 +24,31 @@ struct RenderSurfaceInfo
 			Buffer = new uint32_t[height * width];
 			Width = width;
 			Height = height;
-			Clear();
+			memset(Buffer, 0, Width * Height * sizeof(uint32_t));
+			DrawnRect.Reset();
+			ChangedRect = { 0, 0, (int32_t)Width, (int32_t)Height };
 		}
 	}
 
+	void MarkDrawn(HudDirtyRect rect)
+	{
+		rect.Clip(Width, Height);
+		DrawnRect.Add(rect);
+		ChangedRect.Add(rect);
+	}
+
 	void Clear()
 	{
-		memset(Buffer, 0, Width * Height * sizeof(uint32_t));
+		//Only the area that was drawn to needs to be cleared
+		DrawnRect.Clip(Width, Height);
+		if(!DrawnRect.IsEmpty()) {
+			uint32_t rowSize = DrawnRect.GetWidth() * sizeof(uint32_t);
+			for(int32_t y = DrawnRect.Top; y < DrawnRect.Bottom; y++) {
+				memset(Buffer + y * Width + DrawnRect.Left, 0, rowSize);
+			}
+			ChangedRect.Add(DrawnRect);
+		}
+		DrawnRect.Reset();
 	}
 
 	~RenderSurfaceInfo()
@@ -11,6 +11,7 @@
 #include "Shared/NotificationManager.h"
 #include "Shared/BatteryManager.h"
 #include "Shared/CheatManager.h"
+#include "Shared/Audio/SoundMixer.h"
 #include "Utilities/ZipReader.h"
 #include "Utilities/StringUtilities.h"
 #include "Utilities/HexUtilities.h"
@@ -30,6 +31,8 @@ MesenMovie::~MesenMovie()
 
 void MesenMovie::Stop()
 {
+	EndSeek();
+
 	if(_playing) {
 		bool isEndOfMovie = _lastPollCounter >= _inputData.size();
 
@@ -61,6 +64,11 @@ bool MesenMovie::SetInput(BaseControlDevice *device)
 	uint32_t inputRowIndex = _controlManager->GetPollCounter();
 	_lastPollCounter = inputRowIndex;
 
+	if(_seeking && inputRowIndex >= _seekTarget) {
+		//Reached the frame that was requested, resume normal playback speed
+		EndSeek();
+	}
+
 	if(_inputData.size() > inputRowIndex && _inputData[inputRowIndex].size() > _deviceIndex) {
 		device->SetTextState(_inputData[inputRowIndex][_deviceIndex]);
 
@@ -81,6 +89,66 @@ bool MesenMovie::IsPlaying()
 	return _playing;
 }
 
+bool MesenMovie::SeekTo(uint32_t frame)
+{
+	if(!_playing || _checkpoints.empty()) {
+		return false;
+	}
+
+	frame = std::min(frame, (uint32_t)_inputData.size());
+
+	//Find the last checkpoint at or before the requested frame
+	auto result = std::upper_bound(_checkpoints.begin(), _checkpoints.end(), frame);
+	if(result == _checkpoints.begin()) {
+		return false;
+	}
+	uint32_t checkpointRow = *(--result);
+
+	vector<uint8_t> stateData;
+	if(!_reader->ExtractFile(MovieRecorder::GetCheckpointFilename(checkpointRow), stateData)) {
+		MessageManager::Log("[Movie] Could not load checkpoint for frame " + std::to_string(checkpointRow));
+		return false;
+	}
+
+	auto lock = _emu->AcquireLock();
+
+	stringstream stateStream;
+	stateStream.write((char*)stateData.data(), stateData.size());
+	stateStream.seekg(0, ios::beg);
+	if(!_emu->Deserialize(stateStream, _checkpointFormatVersion, false)) {
+		return false;
+	}
+
+	_controlManager->SetPollCounter(checkpointRow);
+	_lastPollCounter = checkpointRow;
+	_deviceIndex = 0;
+	_emu->GetSoundMixer()->StopAudio(true);
+
+	if(frame > checkpointRow) {
+		//Replay the input rows between the checkpoint and the requested frame at maximum speed
+		if(!_seeking) {
+			_prevMaxSpeed = _emu->GetSettings()->CheckFlag(EmulationFlags::MaximumSpeed);
+		}
+		_seekTarget = frame;
+		_seeking = true;
+		_emu->GetSettings()->SetFlag(EmulationFlags::MaximumSpeed);
+	} else {
+		EndSeek();
+	}
+
+	return true;
+}
+
+void MesenMovie::EndSeek()
+{
+	if(_seeking) {
+		_seeking = false;
+		if(!_prevMaxSpeed) {
+			_emu->GetSettings()->ClearFlag(EmulationFlags::MaximumSpeed);
+		}
+	}
+}
+
 vector<uint8_t> MesenMovie::LoadBattery(string extension)
 {
 	vector<uint8_t> batteryData;
@@ -129,6 +197,8 @@ bool MesenMovie::Play(VirtualFile &file)
 
 	_deviceIndex = 0;
 
+	LoadCheckpointIndex();
+
 	auto emuLock = _emu->AcquireLock();
 	
 	ParseSettings(settingsData);
@@ -278,6 +348,47 @@ string MesenMovie::LoadString(std::unordered_map<string, string> &settings, stri
 	}
 }
 
+void MesenMovie::LoadCheckpointIndex()
+{
+	_checkpoints.clear();
+
+	stringstream indexData;
+	if(!_reader->GetStream("Checkpoints.txt", indexData)) {
+		//Movie has no checkpoints, seeking is not available
+		return;
+	}
+
+	std::unordered_map<string, string> indexSettings;
+	while(!indexData.eof()) {
+		string line;
+		std::getline(indexData, line);
+
+		size_t index = line.find_first_of(' ');
+		if(index != string::npos) {
+			string name = line.substr(0, index);
+			string value = line.substr(index + 1);
+			if(name == MovieKeys::Checkpoint) {
+				try {
+					_checkpoints.push_back((uint32_t)std::stoul(value));
+				} catch(std::exception&) {
+					MessageManager::Log("[Movies] Invalid checkpoint: " + value);
+				}
+			} else {
+				indexSettings[name] = value;
+			}
+		}
+	}
+
+	_checkpointFormatVersion = LoadInt(indexSettings, MovieKeys::CheckpointFormatVersion);
+	if(_checkpointFormatVersion < SaveStateManager::MinimumSupportedVersion || _checkpointFormatVersion > SaveStateManager::FileFormatVersion) {
+		MessageManager::Log("[Movies] Unsupported checkpoint format, seeking is disabled");
+		_checkpoints.clear();
+		return;
+	}
+
+	std::sort(_checkpoints.begin(), _checkpoints.end());
+}
+
 void MesenMovie::LoadCheats()
 {
 	vector<CheatCode> cheats;
@@ -31,6 +31,12 @@ private:
 	string _filename;
 	bool _forTest = false;
 
+	vector<uint32_t> _checkpoints;
+	uint32_t _checkpointFormatVersion = 0;
+	uint32_t _seekTarget = 0;
+	bool _seeking = false;
+	bool _prevMaxSpeed = false;
+
 private:
 	void ParseSettings(stringstream &data);
 	bool ApplySettings(istream& settingsData);
@@ -42,6 +48,9 @@ private:
 	void LoadCheats();
 	bool LoadCheat(string cheatData, CheatCode &code);
 
+	void LoadCheckpointIndex();
+	void EndSeek();
+
 public:
 	MesenMovie(Emulator* emu, bool silent);
 	virtual ~MesenMovie();
@@ -51,6 +60,7 @@ public:
 
 	bool SetInput(BaseControlDevice* device) override;
 	bool IsPlaying() override;
+	bool SeekTo(uint32_t frame) override;
 
 	//Inherited via IBatteryProvider
 	vector<uint8_t> LoadBattery(string extension) override;
@@ -62,6 +62,20 @@ void MovieManager::Stop()
 	_recorder.reset();
 }
 
+bool MovieManager::SeekTo(uint32_t frame)
+{
+	shared_ptr<IMovie> player = _player.lock();
+	return player ? player->SeekTo(frame) : false;
+}
+
+void MovieManager::ProcessEndOfFrame()
+{
+	shared_ptr<MovieRecorder> recorder = _recorder.lock();
+	if(recorder) {
+		recorder->ProcessEndOfFrame();
+	}
+}
+
 bool MovieManager::Playing()
 {
 	return _player != nullptr;
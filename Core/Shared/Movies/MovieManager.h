@@ -17,6 +17,7 @@ public:
 	virtual bool Play(VirtualFile& file) = 0;
 	virtual void Stop() = 0;
 	virtual bool IsPlaying() = 0;
+	virtual bool SeekTo(uint32_t frame) = 0;
 };
 
 class MovieManager
@@ -32,6 +33,8 @@ public:
 	void Record(RecordMovieOptions options);
 	void Play(VirtualFile file, bool silent = false);
 	void Stop();
+	bool SeekTo(uint32_t frame);
+	void ProcessEndOfFrame();
 	bool Playing();
 	bool Recording();
 };
\ No newline at end of file
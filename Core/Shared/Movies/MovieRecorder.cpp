@@ -39,6 +39,10 @@ bool MovieRecorder::Record(RecordMovieOptions options)
 	_inputData = stringstream();
 	_saveStateData = stringstream();
 	_hasSaveState = false;
+	_checkpointInterval = options.CheckpointInterval;
+	_rowCount = 0;
+	_nextCheckpointRow = 0;
+	_checkpointRows.clear();
 
 	if(!_writer->Initialize(_filename)) {
 		MessageManager::DisplayMessage("Movies", "CouldNotWriteToFile", FolderUtilities::GetFilename(_filename, true));
@@ -153,6 +157,8 @@ bool MovieRecorder::Stop()
 			_writer->AddFile(kvp.second, "Battery" + kvp.first);
 		}
 
+		WriteCheckpointIndex();
+
 		bool result = _writer->Save();
 		if(result) {
 			MessageManager::DisplayMessage("Movies", "MovieSaved", FolderUtilities::GetFilename(_filename, true));
@@ -169,6 +175,47 @@ void MovieRecorder::RecordInput(vector<shared_ptr<BaseControlDevice>> devices)
 		_inputData << ("|" + device->GetTextState());
 	}
 	_inputData << "\n";
+	_rowCount++;
+}
+
+string MovieRecorder::GetCheckpointFilename(uint32_t inputRow)
+{
+	return "Checkpoints/" + std::to_string(inputRow) + ".dat";
+}
+
+void MovieRecorder::ProcessEndOfFrame()
+{
+	if(_checkpointInterval > 0 && _writer && _rowCount >= _nextCheckpointRow) {
+		AddCheckpoint();
+	}
+}
+
+void MovieRecorder::AddCheckpoint()
+{
+	//Checkpoints only contain the console's state (settings are already stored in the movie, and no screenshot is needed)
+	//The state is written to the archive right away to avoid keeping every checkpoint in memory until the recording ends
+	std::stringstream state;
+	_emu->Serialize(state, false);
+	_writer->AddFile(state, GetCheckpointFilename(_rowCount));
+	_checkpointRows.push_back(_rowCount);
+
+	_nextCheckpointRow = _rowCount + _checkpointInterval;
+}
+
+void MovieRecorder::WriteCheckpointIndex()
+{
+	if(_checkpointRows.empty()) {
+		return;
+	}
+
+	stringstream index;
+	WriteInt(index, MovieKeys::CheckpointFormatVersion, SaveStateManager::FileFormatVersion);
+	WriteInt(index, MovieKeys::CheckpointInterval, _checkpointInterval);
+	for(uint32_t row : _checkpointRows) {
+		WriteInt(index, MovieKeys::Checkpoint, row);
+	}
+	_writer->AddFile(index, "Checkpoints.txt");
+	_checkpointRows.clear();
 }
 
 void MovieRecorder::OnLoadBattery(string extension, vector<uint8_t> batteryData)
@@ -26,6 +26,14 @@ private:
 	bool _hasSaveState = false;
 	stringstream _saveStateData;
 
+	uint32_t _checkpointInterval = 0;
+	uint32_t _rowCount = 0;
+	uint32_t _nextCheckpointRow = 0;
+	vector<uint32_t> _checkpointRows;
+
+	void AddCheckpoint();
+	void WriteCheckpointIndex();
+
 	void GetGameSettings(stringstream &out);
 	//void WriteCheat(stringstream &out, CodeInfo &code);
 	void WriteString(stringstream &out, string name, string value);
@@ -36,8 +44,11 @@ public:
 	MovieRecorder(Emulator* emu);
 	virtual ~MovieRecorder();
 
+	static string GetCheckpointFilename(uint32_t inputRow);
+
 	bool Record(RecordMovieOptions options);
 	bool Stop();
+	void ProcessEndOfFrame();
 
 	// Inherited via IInputRecorder
 	void RecordInput(vector<shared_ptr<BaseControlDevice>> devices) override;
@@ -0,0 +1,124 @@
+#include "pch.h"
+#include "Shared/Movies/MovieRenderer.h"
+#include "Shared/Movies/MovieManager.h"
+#include "Shared/Emulator.h"
+#include "Shared/EmuSettings.h"
+#include "Shared/NotificationManager.h"
+#include "Shared/Video/VideoDecoder.h"
+#include "Shared/Video/VideoRenderer.h"
+#include "Shared/Audio/SoundMixer.h"
+#include "Utilities/VirtualFile.h"
+#include "Utilities/Timer.h"
+
+MovieRenderer::MovieRenderer(Emulator* emu)
+{
+	_emu = emu;
+	_rendering = false;
+}
+
+void MovieRenderer::ProcessNotification(ConsoleNotificationType type, void* parameter)
+{
+	if(!_rendering) {
+		return;
+	}
+
+	switch(type) {
+		case ConsoleNotificationType::PpuFrameDone:
+			if(_emu->IsRunAheadFrame()) {
+				break;
+			}
+
+			if(_emu->GetMovieManager()->Playing()) {
+				_frameCount++;
+			} else {
+				//The movie ended while this frame was running, this frame is not part of the movie and
+				//hasn't been sent to the decoder yet - stop recording once the previous frame is decoded
+				_emu->GetVideoDecoder()->WaitForFrameDecode();
+				StopRecorders();
+				_signal.Signal();
+			}
+			break;
+
+		case ConsoleNotificationType::BeforeEmulationStop:
+			//Emulation was stopped before the end of the movie (e.g crash)
+			StopRecorders();
+			_signal.Signal();
+			break;
+
+		default:
+			break;
+	}
+}
+
+void MovieRenderer::StopRecorders()
+{
+	if(_rendering.exchange(false)) {
+		_videoStats = _emu->GetVideoRenderer()->StopRecording();
+		_emu->GetSoundMixer()->StopRecording();
+	}
+}
+
+MovieRenderResult MovieRenderer::Render(string romFile, string movieFile, string videoFile, string audioFile, VideoCodec codec, uint32_t compressionLevel)
+{
+	MovieRenderResult result = {};
+
+	VirtualFile rom = romFile;
+	VirtualFile movie = movieFile;
+	if(!rom.IsValid() || !movie.IsValid()) {
+		result.Status = MovieRenderStatus::InvalidFile;
+		return result;
+	}
+
+	_emu->GetNotificationManager()->RegisterNotificationListener(shared_from_this());
+
+	//Every frame must reach the recorder
+	EmuSettings* settings = _emu->GetSettings();
+	settings->GetSnesConfig().DisableFrameSkipping = true;
+	settings->GetPcEngineConfig().DisableFrameSkipping = true;
+
+	Timer timer;
+
+	_emu->Lock();
+	if(!_emu->LoadRom(rom, VirtualFile(""))) {
+		_emu->Unlock();
+		result.Status = MovieRenderStatus::RomLoadFailed;
+		return result;
+	}
+
+	_emu->GetMovieManager()->Play(movie, true);
+	if(!_emu->GetMovieManager()->Playing()) {
+		_emu->Unlock();
+		_emu->Stop(false);
+		result.Status = MovieRenderStatus::InvalidFile;
+		return result;
+	}
+
+	//The blocking queue policy stalls emulation while the encoder catches up instead of dropping frames
+	_frameCount = 0;
+	_videoStats = {};
+	_emu->GetVideoRenderer()->StartRecording(videoFile, codec, compressionLevel, VideoRecordQueuePolicy::Block);
+	if(!audioFile.empty()) {
+		_emu->GetSoundMixer()->StartRecording(audioFile);
+	}
+	settings->SetFlag(EmulationFlags::MaximumSpeed);
+
+	_rendering = true;
+	_emu->Unlock();
+	_signal.Wait();
+	_emu->Stop(false);
+
+	settings->ClearFlag(EmulationFlags::MaximumSpeed);
+
+	result.FrameCount = _frameCount;
+	result.EncodedFrames = _videoStats.EncodedFrames;
+	result.ElapsedTime = timer.GetElapsedMS() / 1000;
+	if(_videoStats.EncodedFrames == 0) {
+		result.Status = MovieRenderStatus::RecorderError;
+	} else if(_videoStats.EncodedFrames < _frameCount) {
+		//The recorder stops when the resolution changes mid-movie (or when the emulation stopped early)
+		result.Status = MovieRenderStatus::IncompleteVideo;
+	} else {
+		result.Status = MovieRenderStatus::Success;
+	}
+	return result;
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include "pch.h"
+#include "Shared/Interfaces/INotificationListener.h"
+#include "Utilities/AutoResetEvent.h"
+#include "Utilities/Video/VideoRecorderQueue.h"
+
+class Emulator;
+enum class VideoCodec;
+
+enum class MovieRenderStatus
+{
+	Success,
+	InvalidFile,
+	RomLoadFailed,
+	RecorderError,
+	IncompleteVideo
+};
+
+struct MovieRenderResult
+{
+	MovieRenderStatus Status;
+	uint32_t FrameCount;
+	uint64_t EncodedFrames;
+	double ElapsedTime;
+};
+
+//Plays a movie at maximum speed (no frame limiter, no audio device) and records every frame it produces
+class MovieRenderer : public INotificationListener, public std::enable_shared_from_this<MovieRenderer>
+{
+private:
+	Emulator* _emu;
+
+	atomic<bool> _rendering;
+	uint32_t _frameCount = 0;
+	VideoRecorderStats _videoStats = {};
+
+	AutoResetEvent _signal;
+
+	void StopRecorders();
+
+public:
+	MovieRenderer(Emulator* emu);
+
+	void ProcessNotification(ConsoleNotificationType type, void* parameter) override;
+	MovieRenderResult Render(string romFile, string movieFile, string videoFile, string audioFile, VideoCodec codec, uint32_t compressionLevel);
+};
@@ -15,6 +15,9 @@ struct RecordMovieOptions
 	char Description[10000] = {};
 
 	RecordMovieFrom RecordFrom = RecordMovieFrom::StartWithoutSaveData;
+
+	//Number of input rows between each checkpoint save state (0 = no checkpoints)
+	uint32_t CheckpointInterval = 0;
 };
 
 namespace MovieKeys
@@ -26,4 +29,8 @@ namespace MovieKeys
 	constexpr const char* PatchFile = "PatchFile";
 	constexpr const char* PatchFileSha1 = "PatchFileSHA1";
 	constexpr const char* PatchedRomSha1 = "PatchedRomSHA1";
+
+	constexpr const char* CheckpointFormatVersion = "CheckpointFormatVersion";
+	constexpr const char* CheckpointInterval = "CheckpointInterval";
+	constexpr const char* Checkpoint = "Checkpoint";
 };
\ No newline at end of file
@@ -0,0 +1,365 @@
+#include "pch.h"
+#include "Shared/RomLibraryIndex.h"
+#include "Utilities/VirtualFile.h"
+#include "Utilities/FolderUtilities.h"
+#include "Utilities/ArchiveReader.h"
+#include "Utilities/CRC32.h"
+#include "Utilities/sha1.h"
+
+RomLibraryIndex::~RomLibraryIndex()
+{
+	Stop();
+}
+
+string RomLibraryIndex::GetIndexPath()
+{
+	return FolderUtilities::CombinePath(FolderUtilities::GetHomeFolder(), "RomLibrary.idx");
+}
+
+void RomLibraryIndex::LoadIndex()
+{
+	std::unique_lock<std::mutex> lock(_lock);
+	if(_loaded) {
+		return;
+	}
+	_loaded = true;
+
+	ifstream file(GetIndexPath(), std::ios::in | std::ios::binary);
+	if(!file) {
+		return;
+	}
+
+	auto readValue = [&file](auto& value) {
+		file.read((char*)&value, sizeof(value));
+	};
+
+	auto readString = [&file, &readValue](string& str) {
+		uint32_t length = 0;
+		readValue(length);
+		if(length > 0x10000) {
+			//Invalid file
+			file.setstate(std::ios::failbit);
+			return;
+		}
+		str.resize(length);
+		file.read(str.data(), length);
+	};
+
+	char header[4] = {};
+	uint32_t version = 0;
+	uint32_t entryCount = 0;
+	file.read(header, 4);
+	readValue(version);
+	readValue(entryCount);
+	if(!file || memcmp(header, "MRLI", 4) != 0 || version != RomLibraryIndex::FileFormatVersion) {
+		return;
+	}
+
+	string path;
+	for(uint32_t i = 0; i < entryCount && file; i++) {
+		RomLibraryEntry entry;
+		uint32_t fileCount = 0;
+		readString(path);
+		readValue(entry.FileSize);
+		readValue(entry.ModifiedTime);
+		readValue(entry.IsArchive);
+		readValue(fileCount);
+		for(uint32_t j = 0; j < fileCount && file; j++) {
+			RomLibraryFile romFile;
+			readString(romFile.Name);
+			readValue(romFile.Crc32);
+			readString(romFile.Sha1);
+			entry.Files.push_back(std::move(romFile));
+		}
+
+		if(file) {
+			_entries[path] = std::move(entry);
+		}
+	}
+
+	if(!file) {
+		//Truncated or corrupted file, discard everything and rebuild the index
+		_entries.clear();
+	}
+}
+
+void RomLibraryIndex::SaveIndex()
+{
+	std::unique_lock<std::mutex> lock(_lock);
+	if(!_modified) {
+		return;
+	}
+	_modified = false;
+
+	ofstream file(GetIndexPath(), std::ios::out | std::ios::binary);
+	if(!file) {
+		return;
+	}
+
+	auto writeValue = [&file](auto value) {
+		file.write((char*)&value, sizeof(value));
+	};
+
+	auto writeString = [&file, &writeValue](const string& str) {
+		writeValue((uint32_t)str.size());
+		file.write(str.data(), str.size());
+	};
+
+	file.write("MRLI", 4);
+	writeValue(RomLibraryIndex::FileFormatVersion);
+	writeValue((uint32_t)_entries.size());
+	for(auto& [path, entry] : _entries) {
+		writeString(path);
+		writeValue(entry.FileSize);
+		writeValue(entry.ModifiedTime);
+		writeValue(entry.IsArchive);
+		writeValue((uint32_t)entry.Files.size());
+		for(RomLibraryFile& romFile : entry.Files) {
+			writeString(romFile.Name);
+			writeValue(romFile.Crc32);
+			writeString(romFile.Sha1);
+		}
+	}
+}
+
+ThreadPool* RomLibraryIndex::GetThreadPool()
+{
+	//Only use half of the cores, the background scan can run while a game is running
+	std::call_once(_threadPoolFlag, [this]() { _threadPool.reset(new ThreadPool(std::max<uint32_t>(ThreadPool::GetDefaultThreadCount() / 2, 1))); });
+	return _threadPool.get();
+}
+
+vector<string> RomLibraryIndex::GetFiles(vector<string>& folders)
+{
+	std::unordered_set<string> extensions(VirtualFile::RomExtensions);
+	extensions.insert(".zip");
+	extensions.insert(".7z");
+
+	vector<string> files;
+	unordered_set<string> checkedFolders;
+	for(string& folder : folders) {
+		if(!checkedFolders.emplace(folder).second) {
+			//Already checked this folder
+			continue;
+		}
+
+		vector<string> folderFiles = FolderUtilities::GetFilesInFolder(folder, extensions, true);
+		files.insert(files.end(), folderFiles.begin(), folderFiles.end());
+	}
+	return files;
+}
+
+bool RomLibraryIndex::GetCachedEntry(const string& path, uint64_t fileSize, int64_t modifiedTime, RomLibraryEntry& entry)
+{
+	std::unique_lock<std::mutex> lock(_lock);
+	auto result = _entries.find(path);
+	if(result == _entries.end() || result->second.FileSize != fileSize || result->second.ModifiedTime != modifiedTime) {
+		return false;
+	}
+
+	entry = result->second;
+	return true;
+}
+
+void RomLibraryIndex::IndexFiles(vector<string>& files)
+{
+	vector<RomLibraryEntry> entries(files.size());
+	vector<uint8_t> hashed(files.size());
+	GetThreadPool()->ParallelFor((uint32_t)files.size(), [&](uint32_t start, uint32_t end) {
+		for(uint32_t i = start; i < end; i++) {
+			hashed[i] = HashFile(files[i], entries[i]);
+		}
+	});
+
+	std::unique_lock<std::mutex> lock(_lock);
+	for(size_t i = 0; i < files.size(); i++) {
+		if(hashed[i]) {
+			_entries[files[i]] = std::move(entries[i]);
+			_modified = true;
+		}
+	}
+}
+
+bool RomLibraryIndex::HashFile(const string& path, RomLibraryEntry& entry)
+{
+	if(!FolderUtilities::GetFileInfo(path, entry.FileSize, entry.ModifiedTime)) {
+		return false;
+	}
+
+	string ext = FolderUtilities::GetExtension(path);
+	entry.IsArchive = ext == ".zip" || ext == ".7z";
+	entry.Files.clear();
+
+	vector<uint8_t> data;
+	if(entry.IsArchive) {
+		unique_ptr<ArchiveReader> reader = ArchiveReader::GetReader(path);
+		if(!reader) {
+			return false;
+		}
+
+		for(string& name : reader->GetFileList(VirtualFile::RomExtensions)) {
+			data.clear();
+			if(reader->ExtractFile(name, data)) {
+				entry.Files.push_back({ name, CRC32::GetCRC(data), SHA1::GetHash(data) });
+			}
+		}
+	} else {
+		if(!VirtualFile(path).ReadFile(data)) {
+			return false;
+		}
+		entry.Files.push_back({ FolderUtilities::GetFilename(path, true), CRC32::GetCRC(data), SHA1::GetHash(data) });
+	}
+	return true;
+}
+
+void RomLibraryIndex::StartScan(vector<string> folders)
+{
+	std::unique_lock<std::mutex> lock(_scanLock);
+	if(_stopFlag) {
+		return;
+	}
+
+	_scanFolders = folders;
+	_scanPending = true;
+	if(!_scanThread.joinable()) {
+		_scanThread = std::thread([this]() { ScanThread(); });
+	}
+	_scanSignal.notify_all();
+}
+
+void RomLibraryIndex::Stop()
+{
+	{
+		std::unique_lock<std::mutex> lock(_scanLock);
+		_stopFlag = true;
+		_scanSignal.notify_all();
+	}
+
+	if(_scanThread.joinable()) {
+		_scanThread.join();
+	}
+}
+
+void RomLibraryIndex::ScanThread()
+{
+	while(true) {
+		vector<string> folders;
+		{
+			std::unique_lock<std::mutex> lock(_scanLock);
+			_scanSignal.wait(lock, [this] { return _scanPending || _stopFlag; });
+
+			//Folders are usually added in a burst (e.g on startup), wait a bit to scan them all at once
+			_scanSignal.wait_for(lock, std::chrono::seconds(1), [this] { return _stopFlag; });
+			if(_stopFlag) {
+				break;
+			}
+
+			folders = _scanFolders;
+			_scanPending = false;
+		}
+
+		LoadIndex();
+
+		RomLibraryEntry entry;
+		vector<string> missingFiles;
+		for(string& file : GetFiles(folders)) {
+			uint64_t fileSize = 0;
+			int64_t modifiedTime = 0;
+			if(FolderUtilities::GetFileInfo(file, fileSize, modifiedTime) && !GetCachedEntry(file, fileSize, modifiedTime, entry)) {
+				missingFiles.push_back(file);
+			}
+		}
+
+		for(size_t i = 0; i < missingFiles.size(); i += RomLibraryIndex::ScanBatchSize) {
+			{
+				std::unique_lock<std::mutex> lock(_scanLock);
+				if(_stopFlag) {
+					break;
+				}
+			}
+
+			vector<string> batch(missingFiles.begin() + i, missingFiles.begin() + std::min<size_t>(i + RomLibraryIndex::ScanBatchSize, missingFiles.size()));
+			IndexFiles(batch);
+		}
+
+		SaveIndex();
+	}
+
+	//Keep whatever was hashed before the stop request
+	SaveIndex();
+}
+
+string RomLibraryIndex::FindMatchingRom(vector<string> folders, string romName, uint32_t crc32)
+{
+	LoadIndex();
+
+	string lcRomName = romName;
+	std::transform(lcRomName.begin(), lcRomName.end(), lcRomName.begin(), ::tolower);
+	lcRomName = FolderUtilities::GetFilename(lcRomName, false);
+
+	auto isNameMatch = [&lcRomName](string filename) {
+		std::transform(filename.begin(), filename.end(), filename.begin(), ::tolower);
+		return FolderUtilities::GetFilename(filename, false) == lcRomName;
+	};
+
+	//Files whose name matches are hashed right away if they aren't indexed yet.
+	//Archives are only checked when their name matches or when their content was already indexed (by the background scan)
+	vector<string> candidates;
+	vector<string> missingFiles;
+	RomLibraryEntry entry;
+	for(string& file : GetFiles(folders)) {
+		bool nameMatch = isNameMatch(file);
+		string ext = FolderUtilities::GetExtension(file);
+		if(!nameMatch && ext != ".zip" && ext != ".7z") {
+			continue;
+		}
+
+		uint64_t fileSize = 0;
+		int64_t modifiedTime = 0;
+		if(!FolderUtilities::GetFileInfo(file, fileSize, modifiedTime)) {
+			continue;
+		}
+
+		bool cached = GetCachedEntry(file, fileSize, modifiedTime, entry);
+		if(cached && entry.IsArchive) {
+			for(RomLibraryFile& romFile : entry.Files) {
+				nameMatch |= isNameMatch(romFile.Name);
+			}
+		}
+
+		if(nameMatch) {
+			candidates.push_back(file);
+			if(!cached) {
+				missingFiles.push_back(file);
+			}
+		}
+	}
+
+	IndexFiles(missingFiles);
+	SaveIndex();
+
+	for(string& file : candidates) {
+		{
+			std::unique_lock<std::mutex> lock(_lock);
+			auto result = _entries.find(file);
+			if(result == _entries.end()) {
+				continue;
+			}
+			entry = result->second;
+		}
+
+		for(RomLibraryFile& romFile : entry.Files) {
+			if(romFile.Crc32 != crc32) {
+				continue;
+			}
+
+			if(!entry.IsArchive) {
+				return file;
+			} else if(isNameMatch(file) || isNameMatch(romFile.Name)) {
+				return (string)VirtualFile(file, romFile.Name);
+			}
+		}
+	}
+
+	return "";
+}
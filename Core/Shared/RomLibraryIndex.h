@@ -0,0 +1,69 @@
+#pragma once
+#include "pch.h"
+#include <mutex>
+#include <condition_variable>
+#include "Utilities/ThreadPool.h"
+
+struct RomLibraryFile
+{
+	//Filename, or path of the file inside the archive for archives
+	string Name;
+	uint32_t Crc32 = 0;
+	string Sha1;
+};
+
+struct RomLibraryEntry
+{
+	uint64_t FileSize = 0;
+	int64_t ModifiedTime = 0;
+	bool IsArchive = false;
+	vector<RomLibraryFile> Files;
+};
+
+//On-disk cache of the hashes of the roms (and archive contents) found in the known game folders.
+//Entries are keyed by path and only rehashed when the file's size or modification time changes.
+class RomLibraryIndex
+{
+private:
+	static constexpr uint32_t FileFormatVersion = 1;
+
+	//Number of files hashed in parallel by the background scan before checking for stop requests
+	static constexpr uint32_t ScanBatchSize = 64;
+
+	std::mutex _lock;
+	unordered_map<string, RomLibraryEntry> _entries;
+	bool _loaded = false;
+	bool _modified = false;
+
+	std::once_flag _threadPoolFlag;
+	unique_ptr<ThreadPool> _threadPool;
+
+	std::thread _scanThread;
+	std::mutex _scanLock;
+	std::condition_variable _scanSignal;
+	vector<string> _scanFolders;
+	bool _scanPending = false;
+	bool _stopFlag = false;
+
+	string GetIndexPath();
+	void LoadIndex();
+	void SaveIndex();
+
+	ThreadPool* GetThreadPool();
+	vector<string> GetFiles(vector<string>& folders);
+	bool GetCachedEntry(const string& path, uint64_t fileSize, int64_t modifiedTime, RomLibraryEntry& entry);
+	void IndexFiles(vector<string>& files);
+	static bool HashFile(const string& path, RomLibraryEntry& entry);
+
+	void ScanThread();
+
+public:
+	~RomLibraryIndex();
+
+	//Queues a background scan that hashes all files in the folders that aren't already indexed
+	void StartScan(vector<string> folders);
+	void Stop();
+
+	//Returns the first file (or archive file) whose name matches romName and whose CRC32 matches crc32
+	string FindMatchingRom(vector<string> folders, string romName, uint32_t crc32);
+};
@@ -112,6 +112,13 @@ struct VideoConfig
 	uint32_t ScreenRotation = 0;
 };
 
+enum class AudioResamplerQuality
+{
+	Low = 0,
+	Medium = 1,
+	High = 2
+};
+
 struct AudioConfig
 {
 	const char* AudioDevice = nullptr;
@@ -121,6 +128,7 @@ struct AudioConfig
 	uint32_t MasterVolume = 100;
 	uint32_t SampleRate = 48000;
 	uint32_t AudioLatency = 60;
+	AudioResamplerQuality ResamplerQuality = AudioResamplerQuality::Medium;
 
 	bool MuteSoundInBackground = false;
 	bool ReduceSoundInBackground = true;
@@ -352,6 +360,7 @@ struct EmulationConfig
 	uint32_t RewindSpeed = 100;
 
 	uint32_t RunAheadFrames = 0;
+	bool AutoFrameDelay = false;
 };
 
 struct OverscanDimensions
@@ -428,6 +437,7 @@ struct PcEngineConfig
 	uint32_t ChannelVol[6] = { 100, 100, 100, 100, 100, 100 };
 	uint32_t CdAudioVolume = 100;
 	uint32_t AdpcmVolume = 100;
+	bool RunPsgOnSeparateThread = false;
 
 	bool RemoveSpriteLimit = false;
 	bool DisableSprites = false;
@@ -471,6 +481,8 @@ struct SnesConfig
 	uint32_t PpuExtraScanlinesBeforeNmi = 0;
 	uint32_t PpuExtraScanlinesAfterNmi = 0;
 	uint32_t GsuClockSpeed = 100;
+	bool RunGsuOnSeparateThread = false;
+	bool RunSgbOnSeparateThread = false;
 
 	int64_t BsxCustomDate = -1;
 };
@@ -661,6 +673,47 @@ struct FrameInfo
 	uint32_t Height;
 };
 
+//Bounding box of the pixels modified on a HUD surface (Right/Bottom are exclusive)
+struct HudDirtyRect
+{
+	int32_t Left = INT32_MAX;
+	int32_t Top = INT32_MAX;
+	int32_t Right = INT32_MIN;
+	int32_t Bottom = INT32_MIN;
+
+	bool IsEmpty() const { return Right <= Left || Bottom <= Top; }
+	uint32_t GetWidth() const { return IsEmpty() ? 0 : Right - Left; }
+	uint32_t GetHeight() const { return IsEmpty() ? 0 : Bottom - Top; }
+
+	void Reset() { *this = {}; }
+
+	__forceinline void Add(int32_t x, int32_t y)
+	{
+		Left = std::min(Left, x);
+		Top = std::min(Top, y);
+		Right = std::max(Right, x + 1);
+		Bottom = std::max(Bottom, y + 1);
+	}
+
+	void Add(const HudDirtyRect& rect)
+	{
+		if(!rect.IsEmpty()) {
+			Left = std::min(Left, rect.Left);
+			Top = std::min(Top, rect.Top);
+			Right = std::max(Right, rect.Right);
+			Bottom = std::max(Bottom, rect.Bottom);
+		}
+	}
+
+	void Clip(uint32_t width, uint32_t height)
+	{
+		Left = std::max(Left, 0);
+		Top = std::max(Top, 0);
+		Right = std::min(Right, (int32_t)width);
+		Bottom = std::min(Bottom, (int32_t)height);
+	}
+};
+
 enum class EmulatorShortcut
 {
 	FastForward,
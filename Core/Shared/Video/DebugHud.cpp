@@ -25,14 +25,17 @@ void DebugHud::ClearScreen()
 	_commands.clear();
 }
 
-void DebugHud::Draw(uint32_t* argbBuffer, FrameInfo frameInfo, OverscanDimensions overscan, uint32_t frameNumber, bool autoScale)
+HudDirtyRect DebugHud::Draw(uint32_t* argbBuffer, FrameInfo frameInfo, OverscanDimensions overscan, uint32_t frameNumber, bool autoScale)
 {
 	auto lock = _commandLock.AcquireSafe();
+	HudDirtyRect drawnRect;
 	for(unique_ptr<DrawCommand> &command : _commands) {
 		command->Draw(argbBuffer, frameInfo, overscan, frameNumber, autoScale);
+		drawnRect.Add(command->GetDrawnRect());
 	}
 	_commands.erase(std::remove_if(_commands.begin(), _commands.end(), [](const unique_ptr<DrawCommand>& c) { return c->Expired(); }), _commands.end());
 	_commandCount = (uint32_t)_commands.size();
+	return drawnRect;
 }
 
 void DebugHud::DrawPixel(int x, int y, int color, int frameCount, int startFrame)
@@ -5,6 +5,7 @@
 #include "Shared/Interfaces/IAudioDevice.h"
 #include "Shared/Emulator.h"
 #include "Shared/EmuSettings.h"
+#include "Shared/FrameLimiter.h"
 
 void DebugStats::DisplayStats(Emulator *emu, double lastFrameTime)
 {
@@ -65,6 +66,23 @@ void DebugStats::DisplayStats(Emulator *emu, double lastFrameTime)
 	ss << "Max Delay: " << std::fixed << std::setprecision(2) << _lastFrameMax << " ms";
 	hud->DrawString(134, 48, ss.str(), 0xFFFFFF, 0xFF000000, 1, startFrame);
 
+	FrameDelayStats delayStats = emu->GetFrameDelayStats();
+	if(delayStats.Enabled) {
+		hud->DrawRectangle(8, 59, 115, 40, 0x40000000, true, 1, startFrame);
+		hud->DrawRectangle(8, 59, 115, 40, 0xFFFFFF, false, 1, startFrame);
+		hud->DrawString(10, 61, "Frame Delay", 0xFFFFFF, 0xFF000000, 1, startFrame);
+
+		ss = std::stringstream();
+		ss << "Delay: " << std::fixed << std::setprecision(2) << delayStats.FrameDelay << " ms";
+		hud->DrawString(10, 70, ss.str(), 0xFFFFFF, 0xFF000000, 1, startFrame);
+
+		ss = std::stringstream();
+		ss << "Latency: " << std::fixed << std::setprecision(2) << delayStats.AverageLatency << " ms";
+		hud->DrawString(10, 79, ss.str(), 0xFFFFFF, 0xFF000000, 1, startFrame);
+
+		hud->DrawString(10, 88, "Missed: " + std::to_string(delayStats.MissedFrames), delayStats.MissedFrames > 0 ? 0xFFA500 : 0xFFFFFF, 0xFF000000, 1, startFrame);
+	}
+
 	hud->DrawRectangle(129, 59, 122, 32, 0xFFFFFF, false, 1, startFrame);
 	hud->DrawRectangle(130, 60, 120, 30, 0x000000, true, 1, startFrame);
 
@@ -86,3 +104,25 @@ void DebugStats::DisplayStats(Emulator *emu, double lastFrameTime)
 		hud->DrawLine(130 + i*2, 60 + 50 - duration*2, 130 + i*2 + 2, 60 + 50 - nextDuration*2, lineColor, 1, startFrame);
 	}
 }
+
+
+void DebugStats::AddFrameCost(double frameCost)
+{
+	_frameCosts[_frameCostIndex] = frameCost;
+	_frameCostIndex = (_frameCostIndex + 1) % 60;
+	_frameCostCount = std::min<uint32_t>(_frameCostCount + 1, 60);
+}
+
+double DebugStats::GetFrameCostEstimate()
+{
+	if(_frameCostCount == 0) {
+		return 0;
+	}
+
+	//Use the 90th percentile of the recent frames - this ignores occasional spikes (e.g when the emulation is paused/resumed)
+	double costs[60];
+	std::copy(_frameCosts, _frameCosts + _frameCostCount, costs);
+	uint32_t index = _frameCostCount * 9 / 10;
+	std::nth_element(costs, costs + index, costs + _frameCostCount);
+	return costs[index];
+}
\ No newline at end of file
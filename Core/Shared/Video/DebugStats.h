@@ -11,6 +11,13 @@ private:
 	double _lastFrameMin = 9999;
 	double _lastFrameMax = 0;
 
+	double _frameCosts[60] = {};
+	uint32_t _frameCostIndex = 0;
+	uint32_t _frameCostCount = 0;
+
 public:
 	void DisplayStats(Emulator *emu, double lastFrameTime);
+
+	void AddFrameCost(double frameCost);
+	double GetFrameCostEstimate();
 };
\ No newline at end of file
@@ -16,6 +16,7 @@ protected:
 	bool _useIntegerScaling = false;
 	float _xScale = 1;
 	int _yScale = 1;
+	HudDirtyRect _drawnRect;
 
 	virtual void InternalDraw() = 0;
 
@@ -60,6 +61,7 @@ protected:
 
 				int32_t offset = ((int32_t)y - top) * _frameInfo.Width + (int32_t)x - left;
 				InternalDrawPixel(offset, color, alpha);
+				_drawnRect.Add((int32_t)x - left, (int32_t)y - top);
 			} else {
 				int xPixelCount = _useIntegerScaling ? (int)std::floor(_xScale): (int)((x + 1)*_xScale) - (int)(x*_xScale);
 				x = (int)(x * (_useIntegerScaling ? (int)std::floor(_xScale) : _xScale));
@@ -73,6 +75,7 @@ protected:
 							continue;
 						}
 						InternalDrawPixel(offset, color, alpha);
+						_drawnRect.Add((int32_t)x - left + j, (int32_t)y - top + i);
 					}
 				}
 			}
@@ -108,6 +111,8 @@ public:
 
 	void Draw(uint32_t* argbBuffer, FrameInfo frameInfo, OverscanDimensions &overscan, uint32_t frameNumber, bool autoScale)
 	{
+		_drawnRect.Reset();
+
 		if(_startFrame < 0) {
 			//When no start frame was specified, start on the next drawn frame
 			_startFrame = frameNumber;
@@ -138,6 +143,12 @@ public:
 	{
 		return _frameCount == 0;
 	}
+
+	//Area of the buffer modified by the last call to Draw()
+	HudDirtyRect GetDrawnRect()
+	{
+		return _drawnRect;
+	}
 };
 
 struct TextSize
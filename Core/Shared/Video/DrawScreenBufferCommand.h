@@ -20,6 +20,7 @@ protected:
 		for(uint32_t y = 0; y < _frameInfo.Height; y++) {
 			memcpy(_argbBuffer + y * _frameInfo.Width, _screenBuffer + srcOffset + y * _width, width * sizeof(uint32_t));
 		}
+		_drawnRect = { 0, 0, width, (int32_t)_frameInfo.Height };
 	}
 
 public:
@@ -0,0 +1,136 @@
+#include "pch.h"
+#include "Shared/Video/HeadlessRenderer.h"
+#include "Shared/Video/VideoRenderer.h"
+#include "Shared/Emulator.h"
+#include "Shared/MessageManager.h"
+#include "Shared/RenderedFrame.h"
+
+HeadlessRenderer::HeadlessRenderer(Emulator* emu, string sharedMemoryName, bool drawHud, uint32_t slotCount, uint32_t maxWidth, uint32_t maxHeight)
+{
+	_emu = emu;
+	_drawHud = drawHud;
+
+	slotCount = std::max<uint32_t>(slotCount, 1);
+	uint32_t slotSize = sizeof(HeadlessFrameSlotHeader) + maxWidth * maxHeight * sizeof(uint32_t);
+	if(sharedMemoryName.empty()) {
+		//No output requested, frames are discarded
+	} else if(_sharedMemory.Create(sharedMemoryName, sizeof(HeadlessFrameRingHeader) + slotSize * slotCount)) {
+		_header = (HeadlessFrameRingHeader*)_sharedMemory.GetBuffer();
+		_header->SlotCount = slotCount;
+		_header->SlotSize = slotSize;
+		_header->MaxWidth = maxWidth;
+		_header->MaxHeight = maxHeight;
+		_header->FramesWritten = 0;
+		_header->FramesDropped = 0;
+		_header->Version = HeadlessFrameRingHeader::CurrentVersion;
+		std::atomic_thread_fence(std::memory_order_release);
+		_header->Magic = HeadlessFrameRingHeader::MagicValue;
+	} else {
+		MessageManager::Log("[Headless] Could not create shared memory: " + sharedMemoryName);
+	}
+
+	_emu->GetVideoRenderer()->RegisterRenderingDevice(this, _drawHud);
+}
+
+HeadlessRenderer::~HeadlessRenderer()
+{
+	_emu->GetVideoRenderer()->UnregisterRenderingDevice(this);
+}
+
+void HeadlessRenderer::PublishFrame(uint32_t* buffer, uint32_t width, uint32_t height, uint32_t frameNumber)
+{
+	if(!_header) {
+		return;
+	}
+
+	if(width > _header->MaxWidth || height > _header->MaxHeight) {
+		_header->FramesDropped++;
+		return;
+	}
+
+	uint64_t frameIndex = _header->FramesWritten.load();
+	uint8_t* slotStart = _sharedMemory.GetBuffer() + sizeof(HeadlessFrameRingHeader) + (frameIndex % _header->SlotCount) * _header->SlotSize;
+	HeadlessFrameSlotHeader* slot = (HeadlessFrameSlotHeader*)slotStart;
+
+	slot->Sequence++;
+	std::atomic_thread_fence(std::memory_order_release);
+	slot->Width = width;
+	slot->Height = height;
+	slot->FrameNumber = frameNumber;
+	memcpy(slotStart + sizeof(HeadlessFrameSlotHeader), buffer, width * height * sizeof(uint32_t));
+	std::atomic_thread_fence(std::memory_order_release);
+	slot->Sequence++;
+
+	_header->FramesWritten = frameIndex + 1;
+}
+
+void HeadlessRenderer::UpdateFrame(RenderedFrame& frame)
+{
+	if(!_drawHud) {
+		//Nothing to compose, publish the frame directly from the decoder thread
+		PublishFrame((uint32_t*)frame.FrameBuffer, frame.Width, frame.Height, frame.FrameNumber);
+		return;
+	}
+
+	auto lock = _frameLock.AcquireSafe();
+	_frameBuffer.resize(frame.Width * frame.Height);
+	memcpy(_frameBuffer.data(), frame.FrameBuffer, _frameBuffer.size() * sizeof(uint32_t));
+	_frameWidth = frame.Width;
+	_frameHeight = frame.Height;
+	_frameNumber = frame.FrameNumber;
+}
+
+void HeadlessRenderer::ClearFrame()
+{
+	auto lock = _frameLock.AcquireSafe();
+	std::fill(_frameBuffer.begin(), _frameBuffer.end(), 0);
+}
+
+void HeadlessRenderer::BlendHud(RenderSurfaceInfo& hud, uint32_t* dst, uint32_t width, uint32_t height)
+{
+	if(!hud.Buffer || hud.DrawnRect.IsEmpty()) {
+		return;
+	}
+
+	//Scale the HUD to the frame's size (nearest neighbor), same as what the other renderers do on the GPU
+	for(uint32_t y = 0; y < height; y++) {
+		uint32_t* src = hud.Buffer + (y * hud.Height / height) * hud.Width;
+		for(uint32_t x = 0; x < width; x++) {
+			uint32_t argb = src[x * hud.Width / width];
+			uint32_t alpha = argb >> 24;
+			if(alpha == 0) {
+				continue;
+			}
+
+			uint32_t& out = dst[y * width + x];
+			if(alpha == 0xFF) {
+				out = argb;
+			} else {
+				uint32_t invAlpha = 0xFF - alpha;
+				uint32_t r = (((argb >> 16) & 0xFF) * alpha + ((out >> 16) & 0xFF) * invAlpha) / 0xFF;
+				uint32_t g = (((argb >> 8) & 0xFF) * alpha + ((out >> 8) & 0xFF) * invAlpha) / 0xFF;
+				uint32_t b = ((argb & 0xFF) * alpha + (out & 0xFF) * invAlpha) / 0xFF;
+				out = 0xFF000000 | (r << 16) | (g << 8) | b;
+			}
+		}
+	}
+}
+
+void HeadlessRenderer::Render(RenderSurfaceInfo& emuHud, RenderSurfaceInfo& scriptHud)
+{
+	uint32_t width, height, frameNumber;
+	{
+		auto lock = _frameLock.AcquireSafe();
+		if(_frameBuffer.empty()) {
+			return;
+		}
+		_outputBuffer = _frameBuffer;
+		width = _frameWidth;
+		height = _frameHeight;
+		frameNumber = _frameNumber;
+	}
+
+	BlendHud(scriptHud, _outputBuffer.data(), width, height);
+	BlendHud(emuHud, _outputBuffer.data(), width, height);
+	PublishFrame(_outputBuffer.data(), width, height, frameNumber);
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include "pch.h"
+#include "Shared/Interfaces/IRenderingDevice.h"
+#include "Utilities/SharedMemory.h"
+#include "Utilities/SimpleLock.h"
+
+class Emulator;
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared memory counters must be lock free");
+
+//Layout of the shared memory block: a HeadlessFrameRingHeader, followed by SlotCount slots of SlotSize bytes.
+//Each slot starts with a HeadlessFrameSlotHeader, followed by Width*Height ARGB pixels.
+struct HeadlessFrameRingHeader
+{
+	static constexpr uint32_t MagicValue = 0x4652534D; //"MSRF"
+	static constexpr uint32_t CurrentVersion = 1;
+
+	uint32_t Magic;
+	uint32_t Version;
+	uint32_t SlotCount;
+	uint32_t SlotSize;
+	uint32_t MaxWidth;
+	uint32_t MaxHeight;
+
+	//Total number of frames published so far, the latest frame is in slot (FramesWritten - 1) % SlotCount
+	std::atomic<uint64_t> FramesWritten;
+
+	//Frames that were larger than MaxWidth*MaxHeight and could not be published
+	std::atomic<uint64_t> FramesDropped;
+};
+
+struct HeadlessFrameSlotHeader
+{
+	//Odd while the slot is being written - readers should copy the frame and discard it if the sequence changed in the meantime
+	std::atomic<uint64_t> Sequence;
+	uint32_t Width;
+	uint32_t Height;
+	uint32_t FrameNumber;
+	uint32_t Reserved;
+};
+
+//Rendering device for headless servers - exposes the final frame through a shared memory ring buffer instead of displaying it
+class HeadlessRenderer : public IRenderingDevice
+{
+private:
+	Emulator* _emu = nullptr;
+	bool _drawHud = false;
+
+	SharedMemory _sharedMemory;
+	HeadlessFrameRingHeader* _header = nullptr;
+
+	SimpleLock _frameLock;
+	vector<uint32_t> _frameBuffer;
+	vector<uint32_t> _outputBuffer;
+	uint32_t _frameWidth = 0;
+	uint32_t _frameHeight = 0;
+	uint32_t _frameNumber = 0;
+
+	void PublishFrame(uint32_t* buffer, uint32_t width, uint32_t height, uint32_t frameNumber);
+	void BlendHud(RenderSurfaceInfo& hud, uint32_t* dst, uint32_t width, uint32_t height);
+
+public:
+	static constexpr uint32_t DefaultSlotCount = 3;
+	static constexpr uint32_t DefaultMaxWidth = 1024;
+	static constexpr uint32_t DefaultMaxHeight = 960;
+
+	HeadlessRenderer(Emulator* emu, string sharedMemoryName, bool drawHud, uint32_t slotCount = DefaultSlotCount, uint32_t maxWidth = DefaultMaxWidth, uint32_t maxHeight = DefaultMaxHeight);
+	virtual ~HeadlessRenderer();
+
+	void UpdateFrame(RenderedFrame& frame) override;
+	void ClearFrame() override;
+	void Render(RenderSurfaceInfo& emuHud, RenderSurfaceInfo& scriptHud) override;
+	void Reset() override {}
+	void SetExclusiveFullscreenMode(bool fullscreen, void* windowHandle) override {}
+};
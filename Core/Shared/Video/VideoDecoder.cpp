@@ -178,13 +178,8 @@ void VideoDecoder::UpdateFrame(RenderedFrame frame, bool sync, bool forRewind)
 		return;
 	}
 
-	if(_frameChanged) {
-		//Last frame isn't done decoding yet - sometimes Signal() introduces a 25-30ms delay
-		while(_frameChanged) {
-			//Spin until decode is done
-		}
-		//At this point, we are sure that the decode thread is no longer busy
-	}
+	//Last frame isn't done decoding yet - sometimes Signal() introduces a 25-30ms delay
+	WaitForFrameDecode();
 
 	_emu->OnBeforeSendFrame();
 
@@ -198,6 +193,14 @@ void VideoDecoder::UpdateFrame(RenderedFrame frame, bool sync, bool forRewind)
 	_frameCount++;
 }
 
+void VideoDecoder::WaitForFrameDecode()
+{
+	while(_frameChanged) {
+		//Spin until decode is done
+	}
+	//At this point, we are sure that the decode thread is no longer busy
+}
+
 void VideoDecoder::StartThread()
 {
 	auto lock = _stopStartLock.AcquireSafe();
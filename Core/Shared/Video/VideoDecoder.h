@@ -61,6 +61,7 @@ public:
 	double GetLastFrameScale() { return _frame.Scale; }
 
 	void UpdateFrame(RenderedFrame frame, bool sync, bool forRewind);
+	void WaitForFrameDecode();
 
 	bool IsRunning();
 	void StartThread();
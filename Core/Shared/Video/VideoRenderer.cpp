@@ -44,6 +44,11 @@ void VideoRenderer::SetRendererSize(uint32_t width, uint32_t height)
 
 void VideoRenderer::StartThread()
 {
+	if(!_drawHud) {
+		//The render thread only composes the HUDs, it isn't needed when the device doesn't display them
+		return;
+	}
+
 	if(!_renderThread) {
 		auto lock = _stopStartLock.AcquireSafe();
 		if(!_renderThread) {
@@ -91,7 +96,7 @@ void VideoRenderer::RenderThread()
 			_emuHudSurface.Clear();
 			_inputHud->DrawControllers(size, frame.InputData);
 			_systemHud->Draw(size.Width, size.Height);
-			_rendererHud->Draw(_emuHudSurface.Buffer, size, {}, 0, false);
+			_emuHudSurface.MarkDrawn(_rendererHud->Draw(_emuHudSurface.Buffer, size, {}, 0, false));
 
 			DrawScriptHud(frame);
 
@@ -113,7 +118,7 @@ void VideoRenderer::DrawScriptHud(RenderedFrame& frame)
 
 		if(_emu->GetScriptHud()->HasCommands()) {
 			auto [size, overscan] = GetScriptHudSize();
-			_emu->GetScriptHud()->Draw(_scriptHudSurface.Buffer, size, overscan, frame.FrameNumber, false);
+			_scriptHudSurface.MarkDrawn(_emu->GetScriptHud()->Draw(_scriptHudSurface.Buffer, size, overscan, frame.FrameNumber, false));
 			_needScriptHudClear = true;
 			_lastScriptHudFrameNumber = frame.FrameNumber;
 		}
@@ -133,6 +138,17 @@ std::pair<FrameInfo, OverscanDimensions> VideoRenderer::GetScriptHudSize()
 
 void VideoRenderer::UpdateFrame(RenderedFrame& frame)
 {
+	if(_pendingRecording) {
+		auto lock = _recordingLock.AcquireSafe();
+		if(_pendingRecording) {
+			unique_ptr<PendingRecording> pending = std::move(_pendingRecording);
+			shared_ptr<IVideoRecorder> newRecorder = CreateRecorder(pending->Filename, pending->Codec, pending->CompressionLevel, pending->QueuePolicy, frame.Width, frame.Height);
+			if(newRecorder && !pending->AudioData.empty()) {
+				newRecorder->AddSound(pending->AudioData.data(), (uint32_t)pending->AudioData.size() / 2, _emu->GetSettings()->GetAudioConfig().SampleRate);
+			}
+		}
+	}
+
 	shared_ptr<IVideoRecorder> recorder = _recorder.lock();
 	if(recorder) {
 		recorder->AddFrame(frame.FrameBuffer, frame.Width, frame.Height, _emu->GetFps());
@@ -145,7 +161,9 @@ void VideoRenderer::UpdateFrame(RenderedFrame& frame)
 
 	if(_renderer) {
 		_renderer->UpdateFrame(frame);
-		_waitForRender.Signal();
+		if(_drawHud) {
+			_waitForRender.Signal();
+		}
 	}
 }
 
@@ -156,8 +174,12 @@ void VideoRenderer::ClearFrame()
 	}
 }
 
-void VideoRenderer::RegisterRenderingDevice(IRenderingDevice *renderer)
+void VideoRenderer::RegisterRenderingDevice(IRenderingDevice *renderer, bool drawHud)
 {
+	if(!drawHud) {
+		StopThread();
+	}
+	_drawHud = drawHud;
 	_renderer = renderer;
 	StartThread();
 }
@@ -167,44 +189,85 @@ void VideoRenderer::UnregisterRenderingDevice(IRenderingDevice *renderer)
 	if(_renderer == renderer) {
 		StopThread();
 		_renderer = nullptr;
+		_drawHud = true;
 	}
 }
 
-void VideoRenderer::StartRecording(string filename, VideoCodec codec, uint32_t compressionLevel)
+shared_ptr<IVideoRecorder> VideoRenderer::CreateRecorder(string filename, VideoCodec codec, uint32_t compressionLevel, VideoRecordQueuePolicy queuePolicy, uint32_t width, uint32_t height)
 {
-	FrameInfo frameInfo = _emu->GetVideoDecoder()->GetFrameInfo();
-
 	shared_ptr<IVideoRecorder> recorder;
 	if(codec == VideoCodec::GIF) {
-		recorder.reset(new GifRecorder());
+		recorder.reset(new GifRecorder(queuePolicy));
 	} else {
-		recorder.reset(new AviRecorder(codec, compressionLevel));
+		recorder.reset(new AviRecorder(codec, compressionLevel, queuePolicy));
 	}
 
-	if(recorder->StartRecording(filename, frameInfo.Width, frameInfo.Height, 4, _emu->GetSettings()->GetAudioConfig().SampleRate, _emu->GetFps())) {
+	if(recorder->StartRecording(filename, width, height, 4, _emu->GetSettings()->GetAudioConfig().SampleRate, _emu->GetFps())) {
 		_recorder.reset(recorder);
 		MessageManager::DisplayMessage("VideoRecorder", "VideoRecorderStarted", filename);
+		return recorder;
 	}
+	return nullptr;
+}
+
+void VideoRenderer::StartRecording(string filename, VideoCodec codec, uint32_t compressionLevel, VideoRecordQueuePolicy queuePolicy)
+{
+	FrameInfo frameInfo = _emu->GetVideoDecoder()->GetFrameInfo();
+	if(frameInfo.Width == 0 || frameInfo.Height == 0) {
+		//No frame has been decoded yet (e.g recording started right after loading a game in the background),
+		//the frame size isn't known yet, so wait for the first frame before creating the recorder
+		auto lock = _recordingLock.AcquireSafe();
+		_pendingRecording.reset(new PendingRecording { filename, codec, compressionLevel, queuePolicy, {} });
+		return;
+	}
+
+	CreateRecorder(filename, codec, compressionLevel, queuePolicy, frameInfo.Width, frameInfo.Height);
 }
 
 void VideoRenderer::AddRecordingSound(int16_t* soundBuffer, uint32_t sampleCount, uint32_t sampleRate)
 {
+	if(_pendingRecording) {
+		auto lock = _recordingLock.AcquireSafe();
+		if(_pendingRecording) {
+			_pendingRecording->AudioData.insert(_pendingRecording->AudioData.end(), soundBuffer, soundBuffer + sampleCount * 2);
+			return;
+		}
+	}
+
 	shared_ptr<IVideoRecorder> recorder = _recorder.lock();
 	if(recorder) {
 		recorder->AddSound(soundBuffer, sampleCount, sampleRate);
 	}
 }
 
-void VideoRenderer::StopRecording()
+VideoRecorderStats VideoRenderer::StopRecording()
 {
+	{
+		auto lock = _recordingLock.AcquireSafe();
+		_pendingRecording.reset();
+	}
+
 	shared_ptr<IVideoRecorder> recorder = _recorder.lock();
+	_recorder.reset();
 	if(recorder) {
+		//Finish encoding all queued frames before reporting the results
+		recorder->StopRecording();
+		VideoRecorderStats stats = recorder->GetStats();
+		if(stats.DroppedFrames > 0) {
+			MessageManager::Log("[Video] " + std::to_string(stats.DroppedFrames) + " frame(s) dropped while recording (" + std::to_string(stats.EncodedFrames) + " encoded)");
+		}
 		MessageManager::DisplayMessage("VideoRecorder", "VideoRecorderStopped", recorder->GetOutputFile());
+		return stats;
 	}
-	_recorder.reset();
+	return {};
 }
 
 bool VideoRenderer::IsRecording()
 {
-	return _recorder != nullptr;
+	return _recorder != nullptr || _pendingRecording != nullptr;
+}
+VideoRecorderStats VideoRenderer::GetRecorderStats()
+{
+	shared_ptr<IVideoRecorder> recorder = _recorder.lock();
+	return recorder ? recorder->GetStats() : VideoRecorderStats {};
 }
\ No newline at end of file
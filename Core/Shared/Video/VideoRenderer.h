@@ -16,6 +16,8 @@ class InputHud;
 
 class IVideoRecorder;
 enum class VideoCodec;
+enum class VideoRecordQueuePolicy;
+struct VideoRecorderStats;
 
 class VideoRenderer
 {
@@ -25,6 +27,7 @@ private:
 	AutoResetEvent _waitForRender;
 	unique_ptr<std::thread> _renderThread;
 	IRenderingDevice* _renderer = nullptr;
+	bool _drawHud = true;
 	atomic<bool> _stopFlag;
 	SimpleLock _stopStartLock;
 
@@ -46,6 +49,20 @@ private:
 
 	safe_ptr<IVideoRecorder> _recorder;
 
+	//Recording requested before any frame was decoded, the recorder is created when the first frame is received
+	struct PendingRecording
+	{
+		string Filename;
+		VideoCodec Codec;
+		uint32_t CompressionLevel;
+		VideoRecordQueuePolicy QueuePolicy;
+		vector<int16_t> AudioData;
+	};
+	unique_ptr<PendingRecording> _pendingRecording;
+	SimpleLock _recordingLock;
+
+	shared_ptr<IVideoRecorder> CreateRecorder(string filename, VideoCodec codec, uint32_t compressionLevel, VideoRecordQueuePolicy queuePolicy, uint32_t width, uint32_t height);
+
 	void RenderThread();
 	void DrawScriptHud(RenderedFrame& frame);
 
@@ -64,11 +81,12 @@ public:
 
 	void UpdateFrame(RenderedFrame& frame);
 	void ClearFrame();
-	void RegisterRenderingDevice(IRenderingDevice *renderer);
+	void RegisterRenderingDevice(IRenderingDevice *renderer, bool drawHud = true);
 	void UnregisterRenderingDevice(IRenderingDevice *renderer);
 
-	void StartRecording(string filename, VideoCodec codec, uint32_t compressionLevel);
+	void StartRecording(string filename, VideoCodec codec, uint32_t compressionLevel, VideoRecordQueuePolicy queuePolicy);
 	void AddRecordingSound(int16_t* soundBuffer, uint32_t sampleCount, uint32_t sampleRate);
-	void StopRecording();
+	VideoRecorderStats StopRecording();
 	bool IsRecording();
+	VideoRecorderStats GetRecorderStats();
 };
\ No newline at end of file
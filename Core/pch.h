@@ -21,6 +21,7 @@
 #include <iomanip>
 #include <fstream>
 #include <string>
+#include <string_view>
 #include <cctype>
 #include <cmath>
 #include <vector>
@@ -66,6 +67,7 @@ using utf8::ofstream;
 using std::list;
 using std::max;
 using std::string;
+using std::string_view;
 using std::atomic_flag;
 using std::atomic;
 using std::thread;
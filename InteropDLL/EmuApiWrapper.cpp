@@ -10,13 +10,20 @@
 #include "Core/Shared/KeyManager.h"
 #include "Core/Shared/ShortcutKeyHandler.h"
 #include "Core/Shared/TimingInfo.h"
+#include "Core/Shared/FrameLimiter.h"
 #include "Core/Shared/CheatManager.h"
 #include "Core/Shared/DebuggerRequest.h"
+#include "Core/Shared/NotificationManager.h"
+#include "Core/Shared/RomLibraryIndex.h"
+#include "Core/Shared/Video/HeadlessRenderer.h"
+#include "Core/Shared/Audio/NullSoundManager.h"
 #include "Core/Netplay/GameClient.h"
 #include "Core/Netplay/GameServer.h"
 #include "Utilities/ArchiveReader.h"
 #include "Utilities/FolderUtilities.h"
 #include "Utilities/StringUtilities.h"
+#include "Utilities/PlatformUtilities.h"
+#include "Utilities/AutoResetEvent.h"
 #include "InteropNotificationListeners.h"
 
 #ifdef _WIN32
@@ -100,6 +107,13 @@ extern "C" {
 		}
 	}
 
+	DllExport void __stdcall InitializeHeadlessDevices(const char* sharedMemoryName, bool drawHud)
+	{
+		//Render to a shared memory ring buffer (or nowhere, if no name is given) and discard audio, without needing a window or any audio/video hardware
+		_renderer.reset(new HeadlessRenderer(_emu.get(), sharedMemoryName ? sharedMemoryName : "", drawHud));
+		_soundManager.reset(new NullSoundManager(_emu.get()));
+	}
+
 	DllExport void __stdcall SetExclusiveFullscreenMode(bool fullscreen, void *windowHandle)
 	{
 		if(_renderer) {
@@ -113,7 +127,11 @@ extern "C" {
 		return _emu->LoadRom((VirtualFile)filename, patchFile ? (VirtualFile)patchFile : VirtualFile());
 	}
 
-	DllExport void __stdcall AddKnownGameFolder(char* folder) { FolderUtilities::AddKnownGameFolder(folder); }
+	DllExport void __stdcall AddKnownGameFolder(char* folder)
+	{
+		FolderUtilities::AddKnownGameFolder(folder);
+		_emu->GetRomLibraryIndex()->StartScan(FolderUtilities::GetKnownGameFolders());
+	}
 
 	DllExport void __stdcall GetRomInfo(InteropRomInfo &info)
 	{
@@ -143,6 +161,11 @@ extern "C" {
 		return _emu->GetTimingInfo(cpuType);
 	}
 
+	DllExport FrameDelayStats __stdcall GetFrameDelayStats()
+	{
+		return _emu->GetFrameDelayStats();
+	}
+
 	DllExport void __stdcall TakeScreenshot() { _emu->GetVideoDecoder()->TakeScreenshot(); }
 
 	DllExport void __stdcall ProcessAudioPlayerAction(AudioPlayerActionParams p) { _emu->ProcessAudioPlayerAction(p); }
@@ -331,4 +354,170 @@ extern "C" {
 			_emu->Release();
 		}
 	}
+	class BenchmarkFrameListener : public INotificationListener
+	{
+	private:
+		Emulator* _emu;
+		uint32_t _frameCount;
+		std::chrono::steady_clock::time_point _lastFrame;
+
+	public:
+		vector<uint64_t> FrameTimes;
+		uint64_t PeakMemoryUsage = 0;
+		atomic<bool> Completed;
+		AutoResetEvent Done;
+
+		BenchmarkFrameListener(Emulator* emu, uint32_t frameCount)
+		{
+			_emu = emu;
+			_frameCount = frameCount;
+			Completed = false;
+			FrameTimes.reserve(frameCount);
+		}
+
+		void ProcessNotification(ConsoleNotificationType type, void* parameter) override
+		{
+			if(type != ConsoleNotificationType::PpuFrameDone || _emu->IsRunAheadFrame() || FrameTimes.size() >= _frameCount) {
+				return;
+			}
+
+			std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+			if(_lastFrame != std::chrono::steady_clock::time_point()) {
+				FrameTimes.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(now - _lastFrame).count());
+
+				//The OS only reports the process-wide peak (which never goes down between runs), sample the current usage instead
+				if((FrameTimes.size() % 10) == 0 || FrameTimes.size() == _frameCount) {
+					PeakMemoryUsage = std::max(PeakMemoryUsage, PlatformUtilities::GetCurrentMemoryUsage());
+				}
+
+				if(FrameTimes.size() == _frameCount) {
+					Completed = true;
+					Done.Signal();
+				}
+			}
+			_lastFrame = now;
+		}
+	};
+
+	static string GetJsonString(string value)
+	{
+		string result = "\"";
+		for(char c : value) {
+			if(c == '"' || c == '\\') {
+				result += '\\';
+			}
+			result += c;
+		}
+		return result + "\"";
+	}
+
+	static void ApplyBenchmarkMix(EmuSettings* settings, string mix)
+	{
+		//Each mix adds one subsystem on top of the previous one ("debugger" and "runahead" are mutually exclusive)
+		bool ppu = mix != "cpu";
+		bool filter = ppu && mix != "ppu";
+		bool audio = filter && mix != "filter";
+
+		//"cpu" lets the SNES/PCE PPUs skip rendering (the NES/GB PPUs always render)
+		settings->GetSnesConfig().DisableFrameSkipping = ppu;
+		settings->GetPcEngineConfig().DisableFrameSkipping = ppu;
+
+		settings->GetVideoConfig().VideoFilter = filter ? VideoFilterType::NtscBlargg : VideoFilterType::None;
+
+		AudioConfig& audioCfg = settings->GetAudioConfig();
+		audioCfg.EnableEqualizer = audio;
+		audioCfg.ReverbEnabled = audio;
+		audioCfg.ReverbStrength = audio ? 5 : 0;
+		audioCfg.CrossFeedEnabled = audio;
+
+		settings->GetEmulationConfig().RunAheadFrames = mix == "runahead" ? 1 : 0;
+	}
+
+	DllExport void __stdcall PgoRunBenchmark(vector<string> testRoms, vector<string> mixes, uint32_t frameCount, char* outputFile)
+	{
+		//Runs each rom for a fixed number of frames (after a warmup period) at maximum speed, for each subsystem mix
+		constexpr uint32_t warmupFrames = 60;
+		constexpr uint32_t timeoutMs = 10 * 60 * 1000;
+
+		FolderUtilities::SetHomeFolder("../PGOMesenHome");
+		PgoKeyManager pgoKeyManager;
+		KeyManager::RegisterKeyManager(&pgoKeyManager);
+
+		std::stringstream json;
+		json << "{\n\t\"frameCount\": " << frameCount << ",\n\t\"results\": [";
+
+		bool first = true;
+		for(string& rom : testRoms) {
+			for(string& mix : mixes) {
+				std::cout << "Running: " << rom << " [" << mix << "]" << std::endl;
+
+				KeyManager::SetSettings(_emu->GetSettings());
+				_emu->Initialize();
+
+				EmuSettings* settings = _emu->GetSettings();
+				settings->GetNesConfig().Port1.Type = ControllerType::NesController;
+				settings->GetNesConfig().Port1.Keys.Mapping1.Start = 10;
+				settings->GetNesConfig().RamPowerOnState = RamState::AllZeros;
+				settings->GetSnesConfig().Port1.Type = ControllerType::SnesController;
+				settings->GetSnesConfig().Port1.Keys.Mapping1.Start = 10;
+				settings->GetSnesConfig().RamPowerOnState = RamState::AllZeros;
+				settings->GetGameboyConfig().Model = GameboyModel::GameboyColor;
+				settings->GetGameboyConfig().Controller.Keys.Mapping1.Start = 10;
+				settings->GetGameboyConfig().RamPowerOnState = RamState::AllZeros;
+				settings->GetPcEngineConfig().Port1.Type = ControllerType::PceController;
+				settings->GetPcEngineConfig().Port1.Keys.Mapping1.Start = 10;
+				settings->GetPcEngineConfig().RamPowerOnState = RamState::AllZeros;
+				ApplyBenchmarkMix(settings, mix);
+				settings->SetFlag(EmulationFlags::MaximumSpeed);
+
+				shared_ptr<BenchmarkFrameListener> listener(new BenchmarkFrameListener(_emu.get(), warmupFrames + frameCount));
+				_emu->GetNotificationManager()->RegisterNotificationListener(listener);
+
+				bool loaded = _emu->LoadRom((VirtualFile)rom, VirtualFile());
+				if(loaded && mix == "debugger") {
+					//Attached during the warmup frames
+					_emu->GetDebugger(true);
+				}
+
+				if(loaded) {
+					listener->Done.Wait(timeoutMs);
+				}
+				bool completed = listener->Completed;
+				_emu->Stop(false);
+				_emu->Release();
+
+				vector<uint64_t> times(listener->FrameTimes.begin() + std::min<size_t>(warmupFrames, listener->FrameTimes.size()), listener->FrameTimes.end());
+				std::sort(times.begin(), times.end());
+				uint64_t totalTime = 0;
+				for(uint64_t time : times) {
+					totalTime += time;
+				}
+				auto percentile = [&](double p) -> uint64_t {
+					return times.empty() ? 0 : times[std::min<size_t>((size_t)(p * times.size()), times.size() - 1)];
+				};
+
+				json << (first ? "" : ",") << "\n\t\t{";
+				json << "\"rom\": " << GetJsonString(rom) << ", ";
+				json << "\"mix\": " << GetJsonString(mix) << ", ";
+				json << "\"completed\": " << (completed ? "true" : "false") << ", ";
+				json << "\"frames\": " << times.size() << ", ";
+				json << "\"fps\": " << (totalTime > 0 ? times.size() * 1000000000.0 / totalTime : 0) << ", ";
+				json << "\"nsPerFrame\": { ";
+				json << "\"p50\": " << percentile(0.5) << ", ";
+				json << "\"p90\": " << percentile(0.9) << ", ";
+				json << "\"p99\": " << percentile(0.99) << ", ";
+				json << "\"max\": " << (times.empty() ? 0 : times.back()) << " }, ";
+				json << "\"peakRssBytes\": " << listener->PeakMemoryUsage;
+				json << "}";
+				first = false;
+			}
+		}
+		json << "\n\t]\n}\n";
+
+		if(outputFile && outputFile[0]) {
+			ofstream out(outputFile, ios::out | ios::binary);
+			out << json.str();
+		}
+		std::cout << json.str();
+	}
 }
\ No newline at end of file
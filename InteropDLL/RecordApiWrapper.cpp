@@ -3,15 +3,19 @@
 #include "Core/Shared/Video/VideoRenderer.h"
 #include "Core/Shared/Audio/SoundMixer.h"
 #include "Core/Shared/Movies/MovieManager.h"
+#include "Core/Shared/Movies/MovieRenderer.h"
+#include "Core/Shared/EmuSettings.h"
+#include "Utilities/Video/VideoRecorderQueue.h"
 
 extern unique_ptr<Emulator> _emu;
 enum class VideoCodec;
 
 extern "C"
 {
-	DllExport void __stdcall AviRecord(char* filename, VideoCodec codec, uint32_t compressionLevel) { _emu->GetVideoRenderer()->StartRecording(filename, codec, compressionLevel); }
+	DllExport void __stdcall AviRecord(char* filename, VideoCodec codec, uint32_t compressionLevel, VideoRecordQueuePolicy queuePolicy) { _emu->GetVideoRenderer()->StartRecording(filename, codec, compressionLevel, queuePolicy); }
 	DllExport void __stdcall AviStop() { _emu->GetVideoRenderer()->StopRecording(); }
 	DllExport bool __stdcall AviIsRecording() { return _emu->GetVideoRenderer()->IsRecording(); }
+	DllExport VideoRecorderStats __stdcall AviGetStats() { return _emu->GetVideoRenderer()->GetRecorderStats(); }
 
 	DllExport void __stdcall WaveRecord(char* filename) { _emu->GetSoundMixer()->StartRecording(filename); }
 	DllExport void __stdcall WaveStop() { _emu->GetSoundMixer()->StopRecording(); }
@@ -19,7 +23,18 @@ extern "C"
 
 	DllExport void __stdcall MoviePlay(char* filename) { _emu->GetMovieManager()->Play(string(filename)); }
 	DllExport void __stdcall MovieStop() { _emu->GetMovieManager()->Stop(); }
+	DllExport bool __stdcall MovieSeekTo(uint32_t frame) { return _emu->GetMovieManager()->SeekTo(frame); }
 	DllExport bool __stdcall MoviePlaying() { return _emu->GetMovieManager()->Playing(); }
 	DllExport bool __stdcall MovieRecording() { return _emu->GetMovieManager()->Recording(); }
 	DllExport void __stdcall MovieRecord(RecordMovieOptions options) { _emu->GetMovieManager()->Record(options); }
+
+	DllExport MovieRenderResult __stdcall MovieRender(char* romFile, char* movieFile, char* videoFile, char* audioFile, VideoCodec codec, uint32_t compressionLevel)
+	{
+		//Render in a separate emulator instance, using the current settings (video filter, audio, etc.)
+		unique_ptr<Emulator> emu(new Emulator());
+		emu->Initialize(false);
+		emu->GetSettings()->CopySettings(*_emu->GetSettings());
+		shared_ptr<MovieRenderer> renderer(new MovieRenderer(emu.get()));
+		return renderer->Render(romFile, movieFile, videoFile, audioFile, codec, compressionLevel);
+	}
 }
\ No newline at end of file
@@ -1,6 +1,15 @@
 #include "Common.h"
 #include "Core/Shared/RecordedRomTest.h"
 #include "Core/Shared/Emulator.h"
+#include "Core/Shared/CpuTestRunner.h"
+#include "Utilities/Video/ZmbvCodec.h"
+#include "Utilities/ThreadPool.h"
+#include "Utilities/Timer.h"
+#include "Utilities/Audio/SincResampler.h"
+#include "Utilities/Audio/Equalizer.h"
+#include "Utilities/Audio/ReverbFilter.h"
+#include "Utilities/Audio/CrossFeedFilter.h"
+#include "Utilities/Audio/orfanidis_eq.h"
 
 extern unique_ptr<Emulator> _emu;
 shared_ptr<RecordedRomTest> _recordedRomTest;
@@ -35,4 +44,196 @@ extern "C"
 	}
 
 	DllExport bool __stdcall RomTestRecording() { return _recordedRomTest != nullptr; }
+
+	DllExport void __stdcall RunCodecBenchmark(uint32_t frameCount)
+	{
+		//Encodes a synthetic scrolling image at 1x, 2x and 4x the SNES/NES resolution,
+		//with and without the worker threads, and checks that both encoders produce the same stream
+		for(uint32_t scale : { 1, 2, 4 }) {
+			uint32_t width = 256 * scale;
+			uint32_t height = 240 * scale;
+			vector<uint32_t> frame(width * height);
+
+			ZmbvCodec singleThreaded(0);
+			ZmbvCodec multiThreaded(ThreadPool::GetDefaultThreadCount());
+			singleThreaded.SetupCompress(width, height, 6);
+			multiThreaded.SetupCompress(width, height, 6);
+
+			double singleTime = 0;
+			double multiTime = 0;
+			bool identical = true;
+			for(uint32_t i = 0; i < frameCount; i++) {
+				for(uint32_t y = 0; y < height; y++) {
+					for(uint32_t x = 0; x < width; x++) {
+						uint32_t tile = ((x + i * 2) / (8 * scale)) ^ ((y + i) / (8 * scale));
+						frame[y * width + x] = 0xFF000000 | (tile * 0x9E3779B1 & 0xFFFFFF);
+					}
+				}
+
+				bool isKeyFrame = i % 120 == 0;
+				uint8_t* singleOutput = nullptr;
+				uint8_t* multiOutput = nullptr;
+
+				Timer timer;
+				int singleSize = singleThreaded.CompressFrame(isKeyFrame, (uint8_t*)frame.data(), &singleOutput);
+				singleTime += timer.GetElapsedMS();
+
+				timer.Reset();
+				int multiSize = multiThreaded.CompressFrame(isKeyFrame, (uint8_t*)frame.data(), &multiOutput);
+				multiTime += timer.GetElapsedMS();
+
+				if(singleSize != multiSize || memcmp(singleOutput, multiOutput, singleSize) != 0) {
+					identical = false;
+				}
+			}
+
+			std::cout << "ZMBV " << width << "x" << height << ": ";
+			std::cout << "1 thread: " << (frameCount * 1000.0 / singleTime) << " fps, ";
+			std::cout << (ThreadPool::GetDefaultThreadCount() + 1) << " threads: " << (frameCount * 1000.0 / multiTime) << " fps";
+			std::cout << (identical ? "" : " (OUTPUT MISMATCH)") << std::endl;
+		}
+	}
+
+	DllExport void __stdcall RunAudioBenchmark(uint32_t frameCount)
+	{
+		//Runs a synthetic SNES-like signal (32040 Hz, 534 samples per frame) through the same chain as SoundMixer:
+		//resampling to 48 kHz, equalizer, reverb, cross feed + volume. Also compares the equalizer
+		//against the reference per-sample orfanidis_eq implementation
+		constexpr uint32_t srcRate = 32040;
+		constexpr uint32_t dstRate = 48000;
+		constexpr uint32_t samplesPerFrame = 534;
+
+		vector<int16_t> input(samplesPerFrame * 2 * frameCount);
+		uint32_t noise = 1;
+		for(size_t i = 0; i < input.size() / 2; i++) {
+			noise = noise * 1103515245 + 12345;
+			double t = (double)i / srcRate;
+			double value = 6000 * std::sin(2 * 3.14159265 * 440 * t) + 3000 * std::sin(2 * 3.14159265 * 3100 * t) + (int16_t)(noise >> 16) / 16;
+			input[i * 2] = (int16_t)value;
+			input[i * 2 + 1] = (int16_t)(value * 0.75);
+		}
+
+		double bandGains[Equalizer::BandCount];
+		for(uint32_t i = 0; i < Equalizer::BandCount; i++) {
+			bandGains[i] = (double)((int)(i * 7 % 13) - 6);
+		}
+
+		SincResampler resampler;
+		Equalizer equalizer;
+		ReverbFilter reverb;
+		CrossFeedFilter crossFeed;
+		resampler.SetTapCount(16);
+		resampler.SetSampleRates(srcRate, dstRate);
+
+		vector<int16_t> output(0x10000);
+		vector<int16_t> eqInput;
+		double times[4] = {};
+		uint64_t outSampleCount = 0;
+
+		for(uint32_t i = 0; i < frameCount; i++) {
+			Timer timer;
+			uint32_t count = resampler.Resample<false>(input.data() + i * samplesPerFrame * 2, samplesPerFrame, output.data(), 0);
+			times[0] += timer.GetElapsedMS();
+
+			eqInput.insert(eqInput.end(), output.begin(), output.begin() + count * 2);
+
+			timer.Reset();
+			equalizer.UpdateEqualizers(bandGains, dstRate);
+			equalizer.ApplyEqualizer(count, output.data());
+			times[1] += timer.GetElapsedMS();
+
+			timer.Reset();
+			reverb.ApplyFilter(output.data(), count, dstRate, 0.5, 1.0);
+			times[2] += timer.GetElapsedMS();
+
+			timer.Reset();
+			crossFeed.ApplyFilter(output.data(), count, 20, 80);
+			times[3] += timer.GetElapsedMS();
+
+			outSampleCount += count;
+		}
+
+		//Reference equalizer (per sample, virtual calls, 2 separate channels)
+		orfanidis_eq::freq_grid grid;
+		for(uint32_t i = 0; i < Equalizer::BandCount; i++) {
+			double minFreq, centerFreq, maxFreq;
+			Equalizer::GetBandFrequencies(i, minFreq, centerFreq, maxFreq);
+			grid.add_band(minFreq, centerFreq, maxFreq);
+		}
+		orfanidis_eq::eq1 refLeft(&grid, orfanidis_eq::filter_type::butterworth);
+		orfanidis_eq::eq1 refRight(&grid, orfanidis_eq::filter_type::butterworth);
+		refLeft.set_sample_rate(dstRate);
+		refRight.set_sample_rate(dstRate);
+		for(uint32_t i = 0; i < Equalizer::BandCount; i++) {
+			refLeft.change_band_gain_db(i, bandGains[i]);
+			refRight.change_band_gain_db(i, bandGains[i]);
+		}
+
+		Equalizer eqCheck;
+		vector<int16_t> eqOutput = eqInput;
+		eqCheck.UpdateEqualizers(bandGains, dstRate);
+		eqCheck.ApplyEqualizer((uint32_t)eqOutput.size() / 2, eqOutput.data());
+
+		Timer timer;
+		int maxDiff = 0;
+		for(size_t i = 0; i < eqInput.size(); i += 2) {
+			double inL = eqInput[i];
+			double inR = eqInput[i + 1];
+			double outL, outR;
+			refLeft.sbs_process(&inL, &outL);
+			refRight.sbs_process(&inR, &outR);
+			int16_t left = (int16_t)std::max(std::min(outL, 32767.0), -32768.0);
+			int16_t right = (int16_t)std::max(std::min(outR, 32767.0), -32768.0);
+			maxDiff = std::max(maxDiff, std::max(std::abs(left - eqOutput[i]), std::abs(right - eqOutput[i + 1])));
+		}
+		double refTime = timer.GetElapsedMS();
+
+		auto printRate = [](const char* name, uint64_t samples, double time) {
+			std::cout << name << ": " << (uint64_t)(samples * 1000.0 / time) << " samples/s" << std::endl;
+		};
+
+		printRate("Resampler (16 taps)", outSampleCount, times[0]);
+		printRate("Equalizer", outSampleCount, times[1]);
+		printRate("Equalizer (reference)", outSampleCount, refTime);
+		printRate("Reverb", outSampleCount, times[2]);
+		printRate("Cross feed + volume", outSampleCount, times[3]);
+		printRate("Full chain", outSampleCount, times[0] + times[1] + times[2] + times[3]);
+		std::cout << "Equalizer max difference vs reference: " << maxDiff << std::endl;
+	}
+
+	DllExport void __stdcall RunCpuTests(char* cpuName, char* testFolder, uint32_t iterations, char* outputFile)
+	{
+		//Runs the single-step test vectors in testFolder (one .json file per opcode) against the given CPU core
+		static const std::pair<string, CpuType> cpuTypes[] = {
+			{ "nes", CpuType::Nes }, { "snes", CpuType::Snes }, { "spc", CpuType::Spc }, { "gb", CpuType::Gameboy }, { "pce", CpuType::Pce }
+		};
+
+		string name = cpuName;
+		auto it = std::find_if(std::begin(cpuTypes), std::end(cpuTypes), [&](const std::pair<string, CpuType>& entry) { return entry.first == name; });
+		if(it == std::end(cpuTypes)) {
+			std::cout << "Unsupported CPU: " << name << " (supported: nes, snes, spc, gb, pce)" << std::endl;
+			return;
+		}
+
+		CpuTestRunner runner(_emu.get(), iterations);
+		vector<CpuTestFileResult> results = runner.Run(it->second, testFolder);
+		for(CpuTestFileResult& result : results) {
+			std::cout << result.Name << ": " << result.Passed << "/" << result.TestCount << " passed";
+			if(result.Skipped) {
+				std::cout << ", " << result.Skipped << " skipped";
+			}
+			std::cout << ", " << result.NsPerOp << " ns/op";
+			if(!result.FirstFailure.empty()) {
+				std::cout << " - " << result.FirstFailure;
+			}
+			std::cout << std::endl;
+		}
+
+		string json = CpuTestRunner::ToJson(it->second, results);
+		if(outputFile && outputFile[0]) {
+			ofstream out(outputFile, ios::out | ios::binary);
+			out << json;
+		}
+		std::cout << json;
+	}
 }
\ No newline at end of file
@@ -170,23 +170,45 @@ void SdlRenderer::UpdateHudSize(HudRenderInfo& hud, uint32_t width, uint32_t hei
 		hud.Height = height;
 		hud.Texture = SDL_CreateTexture(_sdlRenderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, width, height);
 		SDL_SetTextureBlendMode(hud.Texture, SDL_BLENDMODE_BLEND);
+		hud.NeedFullUpdate = true;
 	}
 }
 
-void SdlRenderer::UpdateHudTexture(HudRenderInfo& hud, uint32_t* src)
+void SdlRenderer::UpdateHudTexture(HudRenderInfo& hud, RenderSurfaceInfo& surface)
 {
-	uint8_t* textureBuffer;
-	int rowPitch;
-	if(SDL_LockTexture(hud.Texture, nullptr, (void**)&textureBuffer, &rowPitch) == 0) {
-		for(uint32_t i = 0, iMax = hud.Height; i < iMax; i++) {
-			memcpy(textureBuffer, src, hud.Width * _bytesPerPixel);
-			src += hud.Width;
-			textureBuffer += rowPitch;
+	if(hud.NeedFullUpdate) {
+		//New textures have undefined content
+		surface.ChangedRect = { 0, 0, (int32_t)surface.Width, (int32_t)surface.Height };
+		hud.NeedFullUpdate = false;
+	}
+
+	//Only upload the part of the surface that was drawn or cleared since the last upload
+	HudDirtyRect& rect = surface.ChangedRect;
+	rect.Clip(surface.Width, surface.Height);
+	if(!rect.IsEmpty()) {
+		SDL_Rect dirtyRect = { rect.Left, rect.Top, (int)rect.GetWidth(), (int)rect.GetHeight() };
+		uint32_t* src = surface.Buffer + rect.Top * surface.Width + rect.Left;
+		if(SDL_UpdateTexture(hud.Texture, &dirtyRect, src, surface.Width * _bytesPerPixel) != 0) {
+			LogSdlError("SDL_UpdateTexture failed (HUD)");
 		}
-	} else {
-		LogSdlError("SDL_LockTexture failed (HUD)");
 	}
-	SDL_UnlockTexture(hud.Texture);
+	rect.Reset();
+}
+
+void SdlRenderer::DrawHud(HudRenderInfo& hud, RenderSurfaceInfo& surface, SDL_Rect& dest)
+{
+	UpdateHudSize(hud, surface.Width, surface.Height);
+	if(surface.DrawnRect.IsEmpty()) {
+		//Nothing to display, skip the upload & blit (pending changes are kept until the HUD is displayed again)
+		return;
+	}
+
+	UpdateHudTexture(hud, surface);
+
+	SDL_Rect source = { 0, 0, (int)hud.Width, (int)hud.Height };
+	if(SDL_RenderCopy(_sdlRenderer, hud.Texture, &source, &dest) != 0) {
+		LogSdlError("SDL_RenderCopy failed (HUD)");
+	}
 }
 
 void SdlRenderer::Render(RenderSurfaceInfo& emuHud, RenderSurfaceInfo& scriptHud)
@@ -196,9 +218,6 @@ void SdlRenderer::Render(RenderSurfaceInfo& emuHud, RenderSurfaceInfo& scriptHud
 		return;
 	}
 
-	UpdateHudSize(_emuHud, emuHud.Width, emuHud.Height);
-	UpdateHudSize(_scriptHud, scriptHud.Width, scriptHud.Height);
-
 	if(SDL_RenderClear(_sdlRenderer) != 0) {
 		LogSdlError("SDL_RenderClear failed");
 	}
@@ -221,9 +240,6 @@ void SdlRenderer::Render(RenderSurfaceInfo& emuHud, RenderSurfaceInfo& scriptHud
 	
 	SDL_UnlockTexture(_sdlTexture);
 
-	UpdateHudTexture(_emuHud, emuHud.Buffer);
-	UpdateHudTexture(_scriptHud, scriptHud.Buffer);
-
 	SDL_Rect source = {0, 0, (int)_frameWidth, (int)_frameHeight };
 	SDL_Rect dest = {0, 0, (int)_screenWidth, (int)_screenHeight };
 	
@@ -231,15 +247,8 @@ void SdlRenderer::Render(RenderSurfaceInfo& emuHud, RenderSurfaceInfo& scriptHud
 			LogSdlError("SDL_RenderCopy failed");	
 	}
 
-	SDL_Rect scriptHudSource = { 0, 0, (int)_scriptHud.Width, (int)_scriptHud.Height };
-	if(SDL_RenderCopy(_sdlRenderer, _scriptHud.Texture, &scriptHudSource, &dest) != 0) {
-		LogSdlError("SDL_RenderCopy failed (_scriptHud)");
-	}
-
-	SDL_Rect emuHudSource = { 0, 0, (int)_emuHud.Width, (int)_emuHud.Height };
-	if(SDL_RenderCopy(_sdlRenderer, _emuHud.Texture, &emuHudSource, &dest) != 0) {
-		LogSdlError("SDL_RenderCopy failed (_emuHud)");
-	}
+	DrawHud(_scriptHud, scriptHud, dest);
+	DrawHud(_emuHud, emuHud, dest);
 
 	SDL_RenderPresent(_sdlRenderer);
 }
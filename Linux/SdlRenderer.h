@@ -12,6 +12,7 @@ struct HudRenderInfo
 	SDL_Texture* Texture = nullptr;
 	uint32_t Width = 0;
 	uint32_t Height = 0;
+	bool NeedFullUpdate = false;
 };
 
 class SdlRenderer : public IRenderingDevice
@@ -55,7 +56,8 @@ private:
 	void SetScreenSize(uint32_t width, uint32_t height);
 	
 	void UpdateHudSize(HudRenderInfo& hud, uint32_t width, uint32_t height);
-	void UpdateHudTexture(HudRenderInfo& hud, uint32_t* src);
+	void UpdateHudTexture(HudRenderInfo& hud, RenderSurfaceInfo& surface);
+	void DrawHud(HudRenderInfo& hud, RenderSurfaceInfo& surface, SDL_Rect& dest);
 
 public:
 	SdlRenderer(Emulator* emu, void* windowHandle);
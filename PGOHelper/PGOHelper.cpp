@@ -15,6 +15,10 @@ using std::vector;
 
 extern "C" {
 	void __stdcall PgoRunTest(vector<string> testRoms, bool enableDebugger);
+	void __stdcall RunCodecBenchmark(uint32_t frameCount);
+	void __stdcall RunAudioBenchmark(uint32_t frameCount);
+	void __stdcall PgoRunBenchmark(vector<string> testRoms, vector<string> mixes, uint32_t frameCount, char* outputFile);
+	void __stdcall RunCpuTests(char* cpuName, char* testFolder, uint32_t iterations, char* outputFile);
 }
 
 vector<string> GetFilesInFolder(string rootFolder, std::unordered_set<string> extensions)
@@ -40,10 +44,85 @@ vector<string> GetFilesInFolder(string rootFolder, std::unordered_set<string> ex
 	return files;
 }
 
+vector<string> SplitString(string input, char separator)
+{
+	vector<string> result;
+	size_t start = 0;
+	size_t end;
+	while((end = input.find(separator, start)) != string::npos) {
+		result.push_back(input.substr(start, end - start));
+		start = end + 1;
+	}
+	result.push_back(input.substr(start));
+	return result;
+}
+
+int RunBenchmark(int argc, char* argv[])
+{
+	//Usage: pgohelper --benchmark [romFolder] [--frames=N] [--mixes=cpu,ppu,filter,audio,debugger,runahead] [--output=file.json]
+	string romFolder = "../PGOGames";
+	uint32_t frameCount = 1800;
+	vector<string> mixes = { "cpu", "ppu", "filter", "audio", "debugger", "runahead" };
+	string outputFile;
+
+	for(int i = 2; i < argc; i++) {
+		string arg = argv[i];
+		if(arg.rfind("--frames=", 0) == 0) {
+			frameCount = (uint32_t)std::stoul(arg.substr(9));
+		} else if(arg.rfind("--mixes=", 0) == 0) {
+			mixes = SplitString(arg.substr(8), ',');
+		} else if(arg.rfind("--output=", 0) == 0) {
+			outputFile = arg.substr(9);
+		} else {
+			romFolder = arg;
+		}
+	}
+
+	vector<string> testRoms = GetFilesInFolder(romFolder, { ".sfc", ".gb", ".gbc", ".nes", ".pce", ".cue" });
+	std::sort(testRoms.begin(), testRoms.end());
+	PgoRunBenchmark(testRoms, mixes, frameCount, (char*)outputFile.c_str());
+	return 0;
+}
+
+int RunCpuTestsMode(int argc, char* argv[])
+{
+	//Usage: pgohelper --cpu-tests testFolder --cpu=nes|snes|spc|gb|pce [--iterations=N] [--output=file.json]
+	string testFolder;
+	string cpuName = "nes";
+	uint32_t iterations = 100;
+	string outputFile;
+
+	for(int i = 2; i < argc; i++) {
+		string arg = argv[i];
+		if(arg.rfind("--cpu=", 0) == 0) {
+			cpuName = arg.substr(6);
+		} else if(arg.rfind("--iterations=", 0) == 0) {
+			iterations = (uint32_t)std::stoul(arg.substr(13));
+		} else if(arg.rfind("--output=", 0) == 0) {
+			outputFile = arg.substr(9);
+		} else {
+			testFolder = arg;
+		}
+	}
+
+	RunCpuTests((char*)cpuName.c_str(), (char*)testFolder.c_str(), iterations, (char*)outputFile.c_str());
+	return 0;
+}
+
 int main(int argc, char* argv[])
 {
 	string romFolder = "../PGOGames";
-	if(argc >= 2) {
+	if(argc >= 2 && string(argv[1]) == "--codec-benchmark") {
+		RunCodecBenchmark(600);
+		return 0;
+	} else if(argc >= 2 && string(argv[1]) == "--audio-benchmark") {
+		RunAudioBenchmark(3600);
+		return 0;
+	} else if(argc >= 2 && string(argv[1]) == "--benchmark") {
+		return RunBenchmark(argc, argv);
+	} else if(argc >= 2 && string(argv[1]) == "--cpu-tests") {
+		return RunCpuTestsMode(argc, argv);
+	} else if(argc >= 2) {
 		romFolder = argv[1];
 	}
 
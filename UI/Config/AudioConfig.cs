@@ -19,6 +19,7 @@ namespace Mesen.Config
 		[Reactive] [MinMax(0, 100)] public UInt32 MasterVolume { get; set; } = 100;
 		[Reactive] public AudioSampleRate SampleRate { get; set; } = AudioSampleRate._48000;
 		[Reactive] [MinMax(15, 300)] public UInt32 AudioLatency { get; set; } = 60;
+		[Reactive] public AudioResamplerQuality ResamplerQuality { get; set; } = AudioResamplerQuality.Medium;
 
 		[Reactive] public bool MuteSoundInBackground { get; set; } = false;
 		[Reactive] public bool ReduceSoundInBackground { get; set; } = true;
@@ -69,6 +70,7 @@ namespace Mesen.Config
 				MasterVolume = MasterVolume,
 				SampleRate = (UInt32)SampleRate,
 				AudioLatency = AudioLatency,
+				ResamplerQuality = ResamplerQuality,
 
 				MuteSoundInBackground = MuteSoundInBackground,
 				ReduceSoundInBackground = ReduceSoundInBackground,
@@ -121,6 +123,7 @@ namespace Mesen.Config
 		public UInt32 MasterVolume;
 		public UInt32 SampleRate;
 		public UInt32 AudioLatency;
+		public AudioResamplerQuality ResamplerQuality;
 
 		[MarshalAs(UnmanagedType.I1)] public bool MuteSoundInBackground;
 		[MarshalAs(UnmanagedType.I1)] public bool ReduceSoundInBackground;
@@ -171,4 +174,11 @@ namespace Mesen.Config
 		_48000 = 48000,
 		_96000 = 96000
 	}
+
+	public enum AudioResamplerQuality
+	{
+		Low = 0,
+		Medium = 1,
+		High = 2
+	}
 }
\ No newline at end of file
@@ -17,6 +17,7 @@ namespace Mesen.Config
 		[Reactive] [MinMax(0, 5000)] public UInt32 RewindSpeed { get; set; } = 100;
 
 		[Reactive] [MinMax(0, 10)] public UInt32 RunAheadFrames { get; set; } = 0;
+		[Reactive] public bool AutoFrameDelay { get; set; } = false;
 		
 		public void ApplyConfig()
 		{
@@ -24,7 +25,8 @@ namespace Mesen.Config
 				EmulationSpeed = this.EmulationSpeed,
 				TurboSpeed = this.TurboSpeed,
 				RewindSpeed = this.RewindSpeed,
-				RunAheadFrames = this.RunAheadFrames
+				RunAheadFrames = this.RunAheadFrames,
+				AutoFrameDelay = this.AutoFrameDelay
 			});
 		}
 	}
@@ -37,6 +39,7 @@ namespace Mesen.Config
 		public UInt32 RewindSpeed;
 
 		public UInt32 RunAheadFrames;
+		[MarshalAs(UnmanagedType.I1)] public bool AutoFrameDelay;
 	}
 
 	public enum ConsoleRegion
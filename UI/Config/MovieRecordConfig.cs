@@ -1,5 +1,6 @@
 ﻿using Mesen.Interop;
 using ReactiveUI.Fody.Helpers;
+using System;
 
 namespace Mesen.Config
 {
@@ -8,5 +9,6 @@ namespace Mesen.Config
 		[Reactive] public RecordMovieFrom RecordFrom { get; set; } = RecordMovieFrom.CurrentState;
 		[Reactive] public string Author { get; set; } = "";
 		[Reactive] public string Description { get; set; } = "";
+		[Reactive] public UInt32 CheckpointInterval { get; set; } = 0;
 	}
 }
@@ -40,6 +40,7 @@ namespace Mesen.Config
 		[Reactive][MinMax(0, 100)] public UInt32 Channel6Vol { get; set; } = 100;
 		[Reactive][MinMax(0, 100)] public UInt32 CdAudioVolume { get; set; } = 100;
 		[Reactive][MinMax(0, 100)] public UInt32 AdpcmVolume { get; set; } = 100;
+		[Reactive] public bool RunPsgOnSeparateThread { get; set; } = false;
 
 		[Reactive] public bool RemoveSpriteLimit { get; set; } = false;
 		[Reactive] public bool DisableSprites { get; set; } = false;
@@ -80,6 +81,7 @@ namespace Mesen.Config
 				Channel6Vol = Channel6Vol,
 				CdAudioVolume = CdAudioVolume,
 				AdpcmVolume = AdpcmVolume,
+				RunPsgOnSeparateThread = RunPsgOnSeparateThread,
 
 				RemoveSpriteLimit = RemoveSpriteLimit,
 				DisableBackground = DisableBackground,
@@ -165,6 +167,7 @@ namespace Mesen.Config
 		public UInt32 Channel6Vol;
 		public UInt32 CdAudioVolume;
 		public UInt32 AdpcmVolume;
+		[MarshalAs(UnmanagedType.I1)] public bool RunPsgOnSeparateThread;
 
 		[MarshalAs(UnmanagedType.I1)] public bool RemoveSpriteLimit;
 		[MarshalAs(UnmanagedType.I1)] public bool DisableSprites;
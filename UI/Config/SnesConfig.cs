@@ -58,6 +58,8 @@ namespace Mesen.Config
 		[Reactive] [MinMax(0, 1000)] public UInt32 PpuExtraScanlinesBeforeNmi { get; set; } = 0;
 		[Reactive] [MinMax(0, 1000)] public UInt32 PpuExtraScanlinesAfterNmi { get; set; } = 0;
 		[Reactive] [MinMax(100, 1000)] public UInt32 GsuClockSpeed { get; set; } = 100;
+		[Reactive] public bool RunGsuOnSeparateThread { get; set; } = false;
+		[Reactive] public bool RunSgbOnSeparateThread { get; set; } = false;
 
 		//BSX
 		[Reactive] public bool BsxUseCustomTime { get; set; } = false;
@@ -108,6 +110,8 @@ namespace Mesen.Config
 				PpuExtraScanlinesBeforeNmi = this.PpuExtraScanlinesBeforeNmi,
 				PpuExtraScanlinesAfterNmi = this.PpuExtraScanlinesAfterNmi,
 				GsuClockSpeed = this.GsuClockSpeed,
+				RunGsuOnSeparateThread = this.RunGsuOnSeparateThread,
+				RunSgbOnSeparateThread = this.RunSgbOnSeparateThread,
 				RamPowerOnState = this.RamPowerOnState,
 				BsxCustomDate = this.BsxCustomDate.Ticks + this.BsxCustomTime.Ticks
 			});
@@ -199,6 +203,8 @@ namespace Mesen.Config
 		public UInt32 PpuExtraScanlinesBeforeNmi;
 		public UInt32 PpuExtraScanlinesAfterNmi;
 		public UInt32 GsuClockSpeed;
+		[MarshalAs(UnmanagedType.I1)] public bool RunGsuOnSeparateThread;
+		[MarshalAs(UnmanagedType.I1)] public bool RunSgbOnSeparateThread;
 
 		public long BsxCustomDate;
 	}
@@ -11,6 +11,13 @@ namespace Mesen.Config
 	{
 		[Reactive] public VideoCodec Codec { get; set; } = VideoCodec.CSCD;
 		[Reactive] public UInt32 CompressionLevel { get; set; } = 6;
+		[Reactive] public VideoRecordQueuePolicy QueuePolicy { get; set; } = VideoRecordQueuePolicy.Block;
+	}
+
+	public enum VideoRecordQueuePolicy
+	{
+		Block = 0,
+		DropFrames = 1
 	}
 
 	public enum VideoCodec
@@ -14,14 +14,19 @@ namespace Mesen.Debugger.Labels
 			}
 
 			HashSet<CpuType> cpuTypes = EmuApi.GetRomInfo().CpuTypes;
-			if(cpuTypes.Contains(CpuType.Gameboy)) {
-				SetGameboyDefaultLabels();
-			} else if(cpuTypes.Contains(CpuType.Nes)) {
-				SetDefaultNesLabels();
-			} else if(cpuTypes.Contains(CpuType.Snes)) {
-				SetSnesDefaultLabels();
-			} else if(cpuTypes.Contains(CpuType.Pce)) {
-				SetPceDefaultLabels();
+			DebugApi.BeginLabelUpdate();
+			try {
+				if(cpuTypes.Contains(CpuType.Gameboy)) {
+					SetGameboyDefaultLabels();
+				} else if(cpuTypes.Contains(CpuType.Nes)) {
+					SetDefaultNesLabels();
+				} else if(cpuTypes.Contains(CpuType.Snes)) {
+					SetSnesDefaultLabels();
+				} else if(cpuTypes.Contains(CpuType.Pce)) {
+					SetPceDefaultLabels();
+				}
+			} finally {
+				DebugApi.EndLabelUpdate();
 			}
 		}
 
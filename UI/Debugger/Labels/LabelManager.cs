@@ -73,8 +73,14 @@ namespace Mesen.Debugger.Labels
 
 		public static void SetLabels(IEnumerable<CodeLabel> labels, bool raiseEvents = true)
 		{
-			foreach(CodeLabel label in labels) {
-				SetLabel(label, false);
+			//Core only rebuilds its label lookup tables once, after all labels are set
+			DebugApi.BeginLabelUpdate();
+			try {
+				foreach(CodeLabel label in labels) {
+					SetLabel(label, false);
+				}
+			} finally {
+				DebugApi.EndLabelUpdate();
 			}
 			if(raiseEvents) {
 				ProcessLabelUpdate();
@@ -172,16 +178,26 @@ namespace Mesen.Debugger.Labels
 
 		public static void DeleteLabels(IEnumerable<CodeLabel> labels)
 		{
-			foreach(CodeLabel label in labels) {
-				DeleteLabel(label, false);
+			DebugApi.BeginLabelUpdate();
+			try {
+				foreach(CodeLabel label in labels) {
+					DeleteLabel(label, false);
+				}
+			} finally {
+				DebugApi.EndLabelUpdate();
 			}
 			ProcessLabelUpdate();
 		}
 
 		public static void RefreshLabels(bool raiseEvent)
 		{
-			DebugApi.ClearLabels();
-			LabelManager.SetLabels(new List<CodeLabel>(_labels), raiseEvent);
+			DebugApi.BeginLabelUpdate();
+			try {
+				DebugApi.ClearLabels();
+				LabelManager.SetLabels(new List<CodeLabel>(_labels), raiseEvent);
+			} finally {
+				DebugApi.EndLabelUpdate();
+			}
 		}
 
 		private static void ProcessLabelUpdate()
@@ -543,6 +543,7 @@ namespace Mesen.Debugger.Utilities
 		Record,
 		[IconFile("MediaStop")]
 		Stop,
+		SeekTo,
 		
 		[IconFile("Network")]
 		NetPlay,
@@ -133,6 +133,9 @@ namespace Mesen.Debugger.ViewModels
 				if(cpuTypes.Contains(CpuType.Sa1)) {
 					tabs.Add(GetSnesSa1Tab(ref snesState));
 				}
+				if(snesState.DecompressionCache.MaxCacheSize > 0) {
+					tabs.Add(GetSnesDecompressionCacheTab(ref snesState));
+				}
 				if(cpuTypes.Contains(CpuType.Gameboy)) {
 					GbState gbState = DebugApi.GetConsoleState<GbState>(ConsoleType.Gameboy);
 					string tabPrefix = "GB - ";
@@ -401,6 +404,23 @@ namespace Mesen.Debugger.ViewModels
 			return new RegisterViewerTab(tabPrefix + "APU", entries, Config, CpuType.Gameboy, MemoryType.GameboyMemory);
 		}
 
+		private RegisterViewerTab GetSnesDecompressionCacheTab(ref SnesState state)
+		{
+			DecompressionCacheState cache = state.DecompressionCache;
+			UInt64 streamCount = cache.Hits + cache.Misses;
+
+			List<RegEntry> entries = new List<RegEntry>() {
+				new RegEntry("", "Streams", streamCount),
+				new RegEntry("", "Cache Hits", cache.Hits),
+				new RegEntry("", "Cache Misses", cache.Misses),
+				new RegEntry("", "Hit Rate", streamCount > 0 ? (100.0 * cache.Hits / streamCount).ToString("0.0") + "%" : "n/a"),
+				new RegEntry("", "Cached Streams", cache.EntryCount),
+				new RegEntry("", "Cache Size", (cache.CacheSize / 1024) + " / " + (cache.MaxCacheSize / 1024) + " KB")
+			};
+
+			return new RegisterViewerTab("Decompression", entries, Config);
+		}
+
 		private RegisterViewerTab GetSnesSa1Tab(ref SnesState state)
 		{
 			Sa1State sa1 = state.Sa1.Sa1;
@@ -69,6 +69,8 @@ namespace Mesen.Debugger.ViewModels
 
 		private BaseState? _ppuState;
 		private byte[] _sourceData = Array.Empty<byte>();
+		private MemoryType _sourceDataType;
+		private UInt32 _sourceGeneration = 0;
 
 		[Obsolete("For designer only")]
 		public TileViewerViewModel() : this(CpuType.Snes, new PictureViewer(), null) { }
@@ -416,7 +418,11 @@ namespace Mesen.Debugger.ViewModels
 			_ppuState = DebugApi.GetPpuState(CpuType);
 			
 			RefreshPalette();
-			_sourceData = DebugApi.GetMemoryState(Config.Source);
+			if(_sourceDataType != Config.Source) {
+				_sourceDataType = Config.Source;
+				_sourceGeneration = 0;
+			}
+			DebugApi.UpdateMemoryState(Config.Source, ref _sourceData, ref _sourceGeneration);
 
 			RefreshTab();
 		}
@@ -226,6 +226,8 @@ namespace Mesen.Interop
 
 		[DllImport(DllPath)] public static extern void SetLabel(uint address, MemoryType memType, string label, string comment);
 		[DllImport(DllPath)] public static extern void ClearLabels();
+		[DllImport(DllPath)] public static extern void BeginLabelUpdate();
+		[DllImport(DllPath)] public static extern void EndLabelUpdate();
 
 		[DllImport(DllPath)] public static extern void SetBreakpoints([MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 1)] InteropBreakpoint[] breakpoints, UInt32 length);
 		
@@ -264,6 +266,40 @@ namespace Mesen.Interop
 			return buffer;
 		}
 
+		[DllImport(DllPath, EntryPoint = "GetMemoryChanges")] private static extern UInt32 GetMemoryChangesWrapper(MemoryType type, UInt32 sinceGeneration, [In, Out] MemoryChangeRange[] ranges, UInt32 maxRangeCount, out UInt32 rangeCount);
+		public static MemoryChangeRange[] GetMemoryChanges(MemoryType type, ref UInt32 generation)
+		{
+			MemoryChangeRange[] ranges = new MemoryChangeRange[256];
+			generation = DebugApi.GetMemoryChangesWrapper(type, generation, ranges, (UInt32)ranges.Length, out UInt32 rangeCount);
+			Array.Resize(ref ranges, (int)rangeCount);
+			return ranges;
+		}
+
+		/// <summary>
+		/// Updates a copy of a memory type, only copying the pages that were written to since the last call.
+		/// Pass a generation of 0 to force a full copy.
+		/// </summary>
+		public static void UpdateMemoryState(MemoryType type, ref byte[] buffer, ref UInt32 generation)
+		{
+			int size = DebugApi.GetMemorySize(type);
+			if(buffer.Length != size) {
+				buffer = new byte[size];
+				generation = 0;
+			}
+
+			if(generation == 0) {
+				//Fetch the generation before copying the data, to make sure writes done during the copy are picked up next time
+				DebugApi.GetMemoryChanges(type, ref generation);
+				DebugApi.GetMemoryStateWrapper(type, buffer);
+				return;
+			}
+
+			foreach(MemoryChangeRange range in DebugApi.GetMemoryChanges(type, ref generation)) {
+				byte[] data = DebugApi.GetMemoryValues(type, range.Start, range.End);
+				Array.Copy(data, 0, buffer, range.Start, data.Length);
+			}
+		}
+
 		[DllImport(DllPath)] private static extern DebugTilemapInfo GetTilemap(CpuType cpuType, InteropGetTilemapOptions options, IntPtr state, byte[] vram, UInt32[] palette, IntPtr outputBuffer);
 		public unsafe static DebugTilemapInfo GetTilemap(CpuType cpuType, GetTilemapOptions options, BaseState state, byte[] vram, UInt32[] palette, IntPtr outputBuffer)
 		{
@@ -598,6 +634,12 @@ namespace Mesen.Interop
 		None,
 	}
 
+	public struct MemoryChangeRange
+	{
+		public UInt32 Start;
+		public UInt32 End;
+	}
+
 	[StructLayout(LayoutKind.Sequential)]
 	public struct AddressCounters
 	{
@@ -520,6 +520,15 @@ namespace Mesen.Interop
 		public byte[] Vectors;
 	}
 
+	public struct DecompressionCacheState
+	{
+		public UInt64 Hits;
+		public UInt64 Misses;
+		public UInt32 EntryCount;
+		public UInt32 CacheSize;
+		public UInt32 MaxCacheSize;
+	}
+
 	public struct Sa1State
 	{
 		public UInt16 Sa1ResetVector;
@@ -998,6 +1007,7 @@ namespace Mesen.Interop
 		public DebugSa1State Sa1;
 		public GsuState Gsu;
 		public Cx4State Cx4;
+		public DecompressionCacheState DecompressionCache;
 
 		public SnesDmaControllerState Dma;
 		public InternalRegisterState InternalRegs;
@@ -36,6 +36,8 @@ namespace Mesen.Interop
 
 		[DllImport(DllPath)] public static extern void InitializeEmu([MarshalAs(UnmanagedType.LPUTF8Str)]string homeFolder, IntPtr windowHandle, IntPtr dxViewerHandle, [MarshalAs(UnmanagedType.I1)]bool noAudio, [MarshalAs(UnmanagedType.I1)]bool noVideo, [MarshalAs(UnmanagedType.I1)]bool noInput);
 
+		[DllImport(DllPath)] public static extern void InitializeHeadlessDevices([MarshalAs(UnmanagedType.LPUTF8Str)]string sharedMemoryName, [MarshalAs(UnmanagedType.I1)]bool drawHud);
+
 		[DllImport(DllPath)] public static extern void Release();
 
 		[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool IsRunning();
@@ -75,6 +77,7 @@ namespace Mesen.Interop
 		[DllImport(DllPath)] public static extern void SetExclusiveFullscreenMode([MarshalAs(UnmanagedType.I1)]bool fullscreen, IntPtr windowHandle);
 
 		[DllImport(DllPath)] public static extern TimingInfo GetTimingInfo(CpuType cpuType);
+		[DllImport(DllPath)] public static extern FrameDelayStats GetFrameDelayStats();
 
 		[DllImport(DllPath)] public static extern double GetAspectRatio();
 		[DllImport(DllPath)] public static extern FrameInfo GetBaseScreenSize();
@@ -139,6 +142,15 @@ namespace Mesen.Interop
 		public UInt32 CycleCount;
 	}
 
+	public struct FrameDelayStats
+	{
+		[MarshalAs(UnmanagedType.I1)] public bool Enabled;
+		public double FrameDelay;
+		public double FrameCost;
+		public double AverageLatency;
+		public UInt32 MissedFrames;
+	}
+
 	public struct FrameInfo
 	{
 		public UInt32 Width;
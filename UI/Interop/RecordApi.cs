@@ -12,9 +12,10 @@ namespace Mesen.Interop
 	{
 		private const string DllPath = EmuApi.DllName;
 
-		[DllImport(DllPath)] public static extern void AviRecord([MarshalAs(UnmanagedType.LPUTF8Str)]string filename, VideoCodec codec, UInt32 compressionLevel);
+		[DllImport(DllPath)] public static extern void AviRecord([MarshalAs(UnmanagedType.LPUTF8Str)]string filename, VideoCodec codec, UInt32 compressionLevel, VideoRecordQueuePolicy queuePolicy);
 		[DllImport(DllPath)] public static extern void AviStop();
 		[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool AviIsRecording();
+		[DllImport(DllPath)] public static extern VideoRecorderStats AviGetStats();
 
 		[DllImport(DllPath)] public static extern void WaveRecord([MarshalAs(UnmanagedType.LPUTF8Str)]string filename);
 		[DllImport(DllPath)] public static extern void WaveStop();
@@ -23,8 +24,38 @@ namespace Mesen.Interop
 		[DllImport(DllPath)] public static extern void MoviePlay([MarshalAs(UnmanagedType.LPUTF8Str)]string filename);
 		[DllImport(DllPath)] public static extern void MovieRecord(RecordMovieOptions options);
 		[DllImport(DllPath)] public static extern void MovieStop();
+		[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool MovieSeekTo(UInt32 frame);
 		[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool MoviePlaying();
 		[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool MovieRecording();
+
+		[DllImport(DllPath)] public static extern MovieRenderResult MovieRender([MarshalAs(UnmanagedType.LPUTF8Str)]string romFile, [MarshalAs(UnmanagedType.LPUTF8Str)]string movieFile, [MarshalAs(UnmanagedType.LPUTF8Str)]string videoFile, [MarshalAs(UnmanagedType.LPUTF8Str)]string audioFile, VideoCodec codec, UInt32 compressionLevel);
+	}
+
+	public enum MovieRenderStatus
+	{
+		Success,
+		InvalidFile,
+		RomLoadFailed,
+		RecorderError,
+		IncompleteVideo
+	}
+
+	public struct MovieRenderResult
+	{
+		public MovieRenderStatus Status;
+		public UInt32 FrameCount;
+		public UInt64 EncodedFrames;
+		public double ElapsedTime;
+	}
+
+	public struct VideoRecorderStats
+	{
+		public UInt32 QueuedFrames;
+		public UInt32 QueueSize;
+		public UInt64 EncodedFrames;
+		public UInt64 DroppedFrames;
+		public double AverageEncodeTime;
+		public double MaxEncodeTime;
 	}
 
 	public enum RecordMovieFrom
@@ -40,7 +71,7 @@ namespace Mesen.Interop
 		private const int DescriptionMaxSize = 10000;
 		private const int FilenameMaxSize = 2000;
 
-		public RecordMovieOptions(string filename, string author, string description, RecordMovieFrom recordFrom)
+		public RecordMovieOptions(string filename, string author, string description, RecordMovieFrom recordFrom, UInt32 checkpointInterval = 0)
 		{
 			Author = Encoding.UTF8.GetBytes(author);
 			Array.Resize(ref Author, AuthorMaxSize);
@@ -55,6 +86,7 @@ namespace Mesen.Interop
 			Filename[FilenameMaxSize - 1] = 0;
 
 			RecordFrom = recordFrom;
+			CheckpointInterval = checkpointInterval;
 		}
 
 		[MarshalAs(UnmanagedType.ByValArray, SizeConst = FilenameMaxSize)]
@@ -67,5 +99,6 @@ namespace Mesen.Interop
 		public byte[] Description;
 
 		public RecordMovieFrom RecordFrom;
+		public UInt32 CheckpointInterval;
 	}
 }
@@ -70,6 +70,10 @@ namespace Mesen
 				return TestRunner.Run(args);
 			}
 
+			if(CommandLineHelper.IsMovieRenderer(args)) {
+				return MovieRenderRunner.Run(args);
+			}
+
 			using SingleInstance instance = SingleInstance.Instance;
 			instance.Init(args);
 			if(instance.FirstInstance) {
@@ -28,6 +28,10 @@ public class CommandLineHelper
 	public bool LoadLastSessionRequested { get; private set; }
 	public string? MovieToRecord { get; private set; } = null;
 	public int TestRunnerTimeout { get; private set; } = 100;
+	public string? RenderVideoFile { get; private set; } = null;
+	public string? RenderAudioFile { get; private set; } = null;
+	public string? HeadlessOutput { get; private set; } = null;
+	public bool NoHud { get; private set; }
 	public List<string> LuaScriptsToLoad { get; private set; } = new();
 	public List<string> FilesToLoad { get; private set; } = new();
 
@@ -64,6 +68,8 @@ public class CommandLineHelper
 					case "fullscreen": Fullscreen = true; break;
 					case "donotsavesettings": ConfigManager.DisableSaveSettings = true; break;
 					case "loadlastsession": LoadLastSessionRequested = true; break;
+					case "headless": HeadlessOutput = string.Empty; break;
+					case "nohud": NoHud = true; break;
 					default:
 						if(switchArg.StartsWith("recordmovie=")) {
 							string[] values = switchArg.Split('=');
@@ -82,6 +88,23 @@ public class CommandLineHelper
 								moviePath += "." + FileDialogHelper.MesenMovieExt;
 							}
 							MovieToRecord = moviePath;
+						} else if(switchArg.StartsWith("output=") || switchArg.StartsWith("audiooutput=")) {
+							//Use the original argument to keep the path's case intact
+							string[] values = ConvertArg(arg).Split('=', 2);
+							if(values.Length <= 1 || string.IsNullOrWhiteSpace(values[1])) {
+								//invalid
+								continue;
+							}
+							string outputPath = Path.IsPathRooted(values[1]) ? values[1] : Path.Combine(Program.OriginalFolder, values[1]);
+							if(switchArg.StartsWith("output=")) {
+								RenderVideoFile = outputPath;
+							} else {
+								RenderAudioFile = outputPath;
+							}
+						} else if(switchArg.StartsWith("headless=")) {
+							//Name of the shared memory block the frames are written to (case-sensitive)
+							string[] values = ConvertArg(arg).Split('=', 2);
+							HeadlessOutput = values[1];
 						} else if(switchArg.StartsWith("timeout=")) {
 							string[] values = switchArg.Split('=');
 							if(values.Length <= 1) {
@@ -124,6 +147,11 @@ public class CommandLineHelper
 		return args.Any(arg => CommandLineHelper.ConvertArg(arg).ToLowerInvariant() == "testrunner");
 	}
 
+	public static bool IsMovieRenderer(string[] args)
+	{
+		return args.Any(arg => CommandLineHelper.ConvertArg(arg).ToLowerInvariant() == "rendermovie");
+	}
+
 	public void ProcessPostLoadCommandSwitches(MainWindow wnd)
 	{
 		if(LuaScriptsToLoad.Count > 0) {
@@ -0,0 +1,40 @@
+﻿using Mesen.Config;
+using Mesen.Interop;
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Text;
+using System.Threading.Tasks;
+
+namespace Mesen.Utilities
+{
+	internal class MovieRenderRunner
+	{
+		//Usage: Mesen --rendermovie <rom> <movie.mmo> --output=<video.avi> [--audiooutput=<audio.wav>]
+		internal static int Run(string[] args)
+		{
+			ConfigManager.DisableSaveSettings = true;
+			CommandLineHelper commandLineHelper = new(args, true);
+
+			string? movieFile = commandLineHelper.FilesToLoad.Find(file => Path.GetExtension(file).ToLowerInvariant() == "." + FileDialogHelper.MesenMovieExt);
+			string? romFile = commandLineHelper.FilesToLoad.Find(file => file != movieFile);
+			if(movieFile == null || romFile == null || commandLineHelper.RenderVideoFile == null) {
+				Console.WriteLine("Usage: --rendermovie <rom> <movie.mmo> --output=<video.avi> [--audiooutput=<audio.wav>]");
+				return -1;
+			}
+
+			EmuApi.InitDll();
+			ConfigManager.Config.ApplyConfig();
+			EmuApi.InitializeEmu(ConfigManager.HomeFolder, IntPtr.Zero, IntPtr.Zero, true, true, true);
+
+			VideoRecordConfig cfg = ConfigManager.Config.VideoRecord;
+			MovieRenderResult result = RecordApi.MovieRender(romFile, movieFile, commandLineHelper.RenderVideoFile, commandLineHelper.RenderAudioFile ?? string.Empty, cfg.Codec, cfg.CompressionLevel);
+
+			Console.WriteLine($"{result.Status}: {result.EncodedFrames}/{result.FrameCount} frames rendered in {result.ElapsedTime:0.00}s");
+
+			EmuApi.Release();
+			return result.Status == MovieRenderStatus.Success ? 0 : (int)result.Status;
+		}
+	}
+}
@@ -164,7 +164,7 @@ namespace Mesen.Utilities
 				RecordApi.AviStop();
 			} else {
 				string filename = GetOutputFilename(ConfigManager.AviFolder, ConfigManager.Config.VideoRecord.Codec == VideoCodec.GIF ? ".gif" : ".avi");
-				RecordApi.AviRecord(filename, ConfigManager.Config.VideoRecord.Codec, ConfigManager.Config.VideoRecord.CompressionLevel);
+				RecordApi.AviRecord(filename, ConfigManager.Config.VideoRecord.Codec, ConfigManager.Config.VideoRecord.CompressionLevel, ConfigManager.Config.VideoRecord.QueuePolicy);
 			}
 		}
 
@@ -196,7 +196,8 @@ namespace Mesen.Utilities
 						GetOutputFilename(ConfigManager.MovieFolder, "." + FileDialogHelper.MesenMovieExt),
 						ConfigManager.Config.MovieRecord.Author,
 						ConfigManager.Config.MovieRecord.Description,
-						ConfigManager.Config.MovieRecord.RecordFrom
+						ConfigManager.Config.MovieRecord.RecordFrom,
+						ConfigManager.Config.MovieRecord.CheckpointInterval
 					);
 					RecordApi.MovieRecord(options);
 				}
@@ -29,6 +29,10 @@ namespace Mesen.Utilities
 			ConfigManager.Config.ApplyConfig();
 
 			EmuApi.InitializeEmu(ConfigManager.HomeFolder, IntPtr.Zero, IntPtr.Zero, true, true, true);
+			if(commandLineHelper.HeadlessOutput != null) {
+				//Expose frames through shared memory (no window or audio hardware needed)
+				EmuApi.InitializeHeadlessDevices(commandLineHelper.HeadlessOutput, !commandLineHelper.NoHud);
+			}
 			EmuApi.Pause();
 
 			if(!EmuApi.LoadRom(commandLineHelper.FilesToLoad[0], string.Empty)) {
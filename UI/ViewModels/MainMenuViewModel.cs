@@ -594,6 +594,16 @@ namespace Mesen.ViewModels
 						OnClick = () => {
 							RecordApi.MovieStop();
 						}
+					},
+					new MainMenuAction() {
+						ActionType = ActionType.SeekTo,
+						IsEnabled = () => IsGameRunning && RecordApi.MoviePlaying(),
+						OnClick = async () => {
+							UInt32? frame = await new MovieSeekWindow().ShowCenteredDialog<UInt32?>((Control)wnd);
+							if(frame != null && !RecordApi.MovieSeekTo(frame.Value)) {
+								EmuApi.DisplayMessage("Movies", ResourceHelper.GetMessage("MovieSeekFailed"));
+							}
+						}
 					}
 				}
 			};
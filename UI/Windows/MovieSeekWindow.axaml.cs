@@ -0,0 +1,50 @@
+using Avalonia;
+using Avalonia.Controls;
+using Avalonia.Interactivity;
+using Avalonia.Markup.Xaml;
+using System;
+
+namespace Mesen.Windows
+{
+	public class MovieSeekWindow : Window
+	{
+		private static UInt32 _lastFrame { get; set; } = 0;
+
+		public static readonly StyledProperty<UInt32> FrameProperty = AvaloniaProperty.Register<MovieSeekWindow, UInt32>(nameof(Frame), 0);
+
+		public UInt32 Frame
+		{
+			get { return GetValue(FrameProperty); }
+			set { SetValue(FrameProperty, value); }
+		}
+
+		public MovieSeekWindow()
+		{
+			Frame = _lastFrame;
+
+			InitializeComponent();
+		}
+
+		private void InitializeComponent()
+		{
+			AvaloniaXamlLoader.Load(this);
+		}
+
+		protected override void OnOpened(EventArgs e)
+		{
+			base.OnOpened(e);
+			this.GetControl<NumericUpDown>("txtFrame").Focus();
+		}
+
+		private void Ok_OnClick(object sender, RoutedEventArgs e)
+		{
+			_lastFrame = Frame;
+			Close(Frame);
+		}
+
+		private void Cancel_OnClick(object sender, RoutedEventArgs e)
+		{
+			Close(null!);
+		}
+	}
+}
@@ -45,7 +45,7 @@ namespace Mesen.Windows
 			VideoRecordConfigViewModel model = (VideoRecordConfigViewModel)DataContext!;
 			model.SaveConfig();
 
-			RecordApi.AviRecord(model.SavePath, model.Config.Codec, model.Config.CompressionLevel);
+			RecordApi.AviRecord(model.SavePath, model.Config.Codec, model.Config.CompressionLevel, model.Config.QueuePolicy);
 		}
 
 		private void Cancel_OnClick(object sender, RoutedEventArgs e)
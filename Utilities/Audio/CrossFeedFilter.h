@@ -3,5 +3,6 @@
 class CrossFeedFilter
 {
 public:
-	void ApplyFilter(int16_t* stereoBuffer, size_t sampleCount, int ratio);
+	//Also applies the master volume, to avoid an extra pass over the buffer
+	void ApplyFilter(int16_t* stereoBuffer, size_t sampleCount, int ratio, int volume = 100);
 };
\ No newline at end of file
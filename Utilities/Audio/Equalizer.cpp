@@ -1,45 +1,121 @@
 #include "pch.h"
 #include "Equalizer.h"
-#include "orfanidis_eq.h"
+#include <cmath>
+
+static constexpr double _pi = 3.1415926535897932384626433832795;
+static constexpr double _bandCenterFreqs[Equalizer::BandCount] = { 40, 56, 80, 113, 160, 225, 320, 450, 600, 750, 1000, 2000, 3000, 4000, 5000, 6000, 7000, 10000, 12500, 13000 };
+
+void Equalizer::GetBandFrequencies(uint32_t band, double& minFreq, double& centerFreq, double& maxFreq)
+{
+	//The first and last bands extend by the same distance as their neighbor
+	const double* f = _bandCenterFreqs;
+	double prev = band == 0 ? f[0] - (f[1] - f[0]) : f[band - 1];
+	double next = band == BandCount - 1 ? f[BandCount - 1] + (f[BandCount - 1] - f[BandCount - 2]) : f[band + 1];
+
+	centerFreq = f[band];
+	minFreq = (centerFreq + prev) / 2;
+	maxFreq = (next + centerFreq) / 2;
+}
+
+void Equalizer::InitSections(uint32_t band, double w0, double wb)
+{
+	//Adapted from orfanidis_eq's butterworth_bp_filter (N = 4, G = 0dB, Gb = -3dB, G0 = -60dB)
+	constexpr uint32_t order = SectionCount * 2;
+	double gb = std::pow(10.0, -3.0 / 20);
+	double g0Lin = std::pow(10.0, -60.0 / 20);
+
+	double epsilon = std::sqrt((1.0 - gb * gb) / (gb * gb - g0Lin * g0Lin));
+	double g = 1.0;
+	double g0 = std::pow(g0Lin, 1.0 / order);
+	double beta = std::pow(epsilon, -1.0 / order) * std::tan(wb / 2.0);
+
+	double c0 = std::cos(w0);
+	if(w0 == 0) c0 = 1;
+	if(w0 == _pi / 2) c0 = 0;
+	if(w0 == _pi) c0 = -1;
+
+	for(uint32_t i = 0; i < SectionCount; i++) {
+		double ui = (2.0 * (i + 1) - 1) / order;
+		double s = std::sin(_pi * ui / 2.0);
+		double d = beta * beta + 2 * s * beta + 1;
+
+		FilterSection& section = _sections[i];
+		for(uint32_t lane : { band, band + BandCount }) {
+			section.B0[lane] = (g * g * beta * beta + 2 * g * g0 * s * beta + g0 * g0) / d;
+			section.B1[lane] = -4 * c0 * (g0 * g0 + g * g0 * s * beta) / d;
+			section.B2[lane] = 2 * (g0 * g0 * (1 + 2 * c0 * c0) - g * g * beta * beta) / d;
+			section.B3[lane] = -4 * c0 * (g0 * g0 - g * g0 * s * beta) / d;
+			section.B4[lane] = (g * g * beta * beta - 2 * g * g0 * s * beta + g0 * g0) / d;
+
+			section.A1[lane] = -4 * c0 * (1 + s * beta) / d;
+			section.A2[lane] = 2 * (1 + 2 * c0 * c0 - beta * beta) / d;
+			section.A3[lane] = -4 * c0 * (1 - s * beta) / d;
+			section.A4[lane] = (beta * beta - 2 * s * beta + 1) / d;
+
+			section.S1[lane] = section.S2[lane] = section.S3[lane] = section.S4[lane] = 0;
+		}
+	}
+}
 
 void Equalizer::ApplyEqualizer(uint32_t sampleCount, int16_t *samples)
 {
-	double outL, outR;
+	alignas(32) double values[LaneCount];
+
 	for(uint32_t i = 0; i < sampleCount; i++) {
 		double inL = samples[i * 2];
 		double inR = samples[i * 2 + 1];
-			
-		_equalizerLeft->sbs_process(&inL, &outL);
-		_equalizerRight->sbs_process(&inR, &outR);
+		for(uint32_t j = 0; j < BandCount; j++) {
+			values[j] = inL;
+			values[j + BandCount] = inR;
+		}
+
+		for(uint32_t j = 0; j < SectionCount; j++) {
+			FilterSection& s = _sections[j];
+			for(uint32_t k = 0; k < LaneCount; k++) {
+				double in = values[k];
+				double out = s.B0[k] * in + s.S1[k];
+				if(out < 0.000000000001 && out > -0.000000000001) {
+					//Prevent denormalized values (causes extreme performance loss)
+					out = 0;
+				}
+				s.S1[k] = s.B1[k] * in - s.A1[k] * out + s.S2[k];
+				s.S2[k] = s.B2[k] * in - s.A2[k] * out + s.S3[k];
+				s.S3[k] = s.B3[k] * in - s.A3[k] * out + s.S4[k];
+				s.S4[k] = s.B4[k] * in - s.A4[k] * out;
+				values[k] = out;
+			}
+		}
+
+		double outL = 0;
+		double outR = 0;
+		for(uint32_t j = 0; j < BandCount; j++) {
+			outL += values[j] * _gains[j];
+			outR += values[j + BandCount] * _gains[j + BandCount];
+		}
 
 		samples[i * 2] = (int16_t)std::max(std::min(outL, 32767.0), -32768.0);
 		samples[i * 2 + 1] = (int16_t)std::max(std::min(outR, 32767.0), -32768.0);
 	}
 }
 
-void Equalizer::UpdateEqualizers(vector<double> bandGains, uint32_t sampleRate)
+void Equalizer::UpdateEqualizers(const double bandGains[BandCount], uint32_t sampleRate)
 {
-	if(_prevSampleRate != sampleRate || memcmp(bandGains.data(), _prevEqualizerGains.data(), bandGains.size() * sizeof(double)) != 0) {
-		vector<double> bands = { 40, 56, 80, 113, 160, 225, 320, 450, 600, 750, 1000, 2000, 3000, 4000, 5000, 6000, 7000, 10000, 12500, 13000 };
-		bands.insert(bands.begin(), bands[0] - (bands[1] - bands[0]));
-		bands.insert(bands.end(), bands[bands.size() - 1] + (bands[bands.size() - 1] - bands[bands.size() - 2]));
-
-		_eqFrequencyGrid.reset(new orfanidis_eq::freq_grid());
-		for(size_t i = 1; i < bands.size() - 1; i++) {
-			_eqFrequencyGrid->add_band((bands[i] + bands[i - 1]) / 2, bands[i], (bands[i + 1] + bands[i]) / 2);
+	bool initialized = _prevSampleRate != 0;
+	if(_prevSampleRate != sampleRate) {
+		//Filter coefficients only depend on the sample rate (this resets the filters' state)
+		for(uint32_t i = 0; i < BandCount; i++) {
+			double minFreq, centerFreq, maxFreq;
+			GetBandFrequencies(i, minFreq, centerFreq, maxFreq);
+			InitSections(i, 2 * _pi * centerFreq / sampleRate, 2 * _pi * (maxFreq - minFreq) / sampleRate);
 		}
+		_prevSampleRate = sampleRate;
+	}
 
-		_equalizerLeft.reset(new orfanidis_eq::eq1(_eqFrequencyGrid.get(), orfanidis_eq::filter_type::butterworth));
-		_equalizerRight.reset(new orfanidis_eq::eq1(_eqFrequencyGrid.get(), orfanidis_eq::filter_type::butterworth));
-		_equalizerLeft->set_sample_rate(sampleRate);
-		_equalizerRight->set_sample_rate(sampleRate);
-
-		for(unsigned int i = 0; i < _eqFrequencyGrid->get_number_of_bands(); i++) {
-			_equalizerLeft->change_band_gain_db(i, bandGains[i]);
-			_equalizerRight->change_band_gain_db(i, bandGains[i]);
+	if(!initialized || memcmp(bandGains, _prevGains, sizeof(_prevGains)) != 0) {
+		//Gains are applied to each band's output, the filters' state can be kept as is
+		for(uint32_t i = 0; i < BandCount; i++) {
+			_gains[i] = _gains[i + BandCount] = std::pow(10.0, bandGains[i] / 20);
 		}
-
-		_prevSampleRate = sampleRate;
-		_prevEqualizerGains = bandGains;
+		memcpy(_prevGains, bandGains, sizeof(_prevGains));
 	}
 }
@@ -1,18 +1,50 @@
 #pragma once
 #include "pch.h"
-#include "orfanidis_eq.h"
 
+//20-band equalizer - each band is a 4th order butterworth band filter (Orfanidis design)
+//All bands for both channels are processed in parallel (structure of arrays) to allow the compiler to vectorize the filters
 class Equalizer
 {
+public:
+	static constexpr uint32_t BandCount = 20;
+
 private:
-	unique_ptr<orfanidis_eq::freq_grid> _eqFrequencyGrid;
-	unique_ptr<orfanidis_eq::eq1> _equalizerLeft;
-	unique_ptr<orfanidis_eq::eq1> _equalizerRight;
+	//4th order band filters are made of 2 cascaded 4th order sections
+	static constexpr uint32_t SectionCount = 2;
+
+	//Lanes 0-19 are the left channel's bands, 20-39 are the right channel's bands
+	static constexpr uint32_t LaneCount = BandCount * 2;
+
+	struct alignas(32) FilterSection
+	{
+		double B0[LaneCount];
+		double B1[LaneCount];
+		double B2[LaneCount];
+		double B3[LaneCount];
+		double B4[LaneCount];
+		double A1[LaneCount];
+		double A2[LaneCount];
+		double A3[LaneCount];
+		double A4[LaneCount];
+
+		//Transposed direct form II state
+		double S1[LaneCount];
+		double S2[LaneCount];
+		double S3[LaneCount];
+		double S4[LaneCount];
+	};
+
+	FilterSection _sections[SectionCount] = {};
+	alignas(32) double _gains[LaneCount] = {};
 
 	uint32_t _prevSampleRate = 0;
-	vector<double> _prevEqualizerGains;
+	double _prevGains[BandCount] = {};
+
+	void InitSections(uint32_t band, double w0, double wb);
 
 public:
 	void ApplyEqualizer(uint32_t sampleCount, int16_t *samples);
-	void UpdateEqualizers(vector<double> bandGains, uint32_t sampleRate);
-};
\ No newline at end of file
+	void UpdateEqualizers(const double bandGains[BandCount], uint32_t sampleRate);
+
+	static void GetBandFrequencies(uint32_t band, double& minFreq, double& centerFreq, double& maxFreq);
+};
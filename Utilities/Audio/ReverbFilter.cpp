@@ -3,7 +3,7 @@
 
 void ReverbFilter::ResetFilter()
 {
-	for(int i = 0; i < 5; i++) {
+	for(int i = 0; i < 10; i++) {
 		_delay[i].Reset();
 	}
 }
@@ -1,14 +1,36 @@
 #pragma once
 #include "pch.h"
-#include <deque>
 
 class ReverbDelay
 {
 private:
-	std::deque<int16_t> _samples;
+	//FIFO of previous output samples, stored in a ring buffer (power of 2 size, grows as needed)
+	vector<int16_t> _samples;
+	uint32_t _readPos = 0;
+	uint32_t _size = 0;
 	uint32_t _delay = 0;
 	double _decay = 0;
 
+	void Reserve(uint32_t size)
+	{
+		if(size <= _samples.size()) {
+			return;
+		}
+
+		uint32_t capacity = 0x400;
+		while(capacity < size) {
+			capacity <<= 1;
+		}
+
+		vector<int16_t> samples(capacity);
+		uint32_t mask = (uint32_t)_samples.size() - 1;
+		for(uint32_t i = 0; i < _size; i++) {
+			samples[i] = _samples[(_readPos + i) & mask];
+		}
+		_samples.swap(samples);
+		_readPos = 0;
+	}
+
 public:
 	void SetParameters(double delay, double decay, int32_t sampleRate)
 	{
@@ -16,31 +38,39 @@ public:
 		if(delaySampleCount != _delay || decay != _decay) {
 			_delay = delaySampleCount;
 			_decay = decay;
-			_samples.clear();
+			Reset();
 		}
 	}
 
 	void Reset()
 	{
-		_samples.clear();
+		_readPos = 0;
+		_size = 0;
 	}
 
 	void AddSamples(int16_t* buffer, size_t sampleCount)
 	{
+		Reserve(_size + (uint32_t)sampleCount);
+
+		uint32_t mask = (uint32_t)_samples.size() - 1;
+		uint32_t writePos = _readPos + _size;
 		for(size_t i = 0; i < sampleCount; i++) {
-			_samples.push_back(buffer[i*2]);
+			_samples[(writePos + i) & mask] = buffer[i*2];
 		}
+		_size += (uint32_t)sampleCount;
 	}
 
 	void ApplyReverb(int16_t* buffer, size_t sampleCount)
 	{
-		if(_samples.size() > _delay) {
-			size_t samplesToInsert = std::min<size_t>(_samples.size() - _delay, sampleCount);
+		if(_size > _delay) {
+			size_t samplesToInsert = std::min<size_t>(_size - _delay, sampleCount);
 
+			uint32_t mask = (uint32_t)_samples.size() - 1;
 			for(size_t j = sampleCount - samplesToInsert; j < sampleCount; j++) {
-				buffer[j*2] += (int16_t)((double)_samples.front() * _decay);
-				_samples.pop_front();
+				buffer[j*2] += (int16_t)((double)_samples[_readPos] * _decay);
+				_readPos = (_readPos + 1) & mask;
 			}
+			_size -= (uint32_t)samplesToInsert;
 		}
 	}
 };
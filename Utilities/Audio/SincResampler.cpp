@@ -0,0 +1,186 @@
+#include "pch.h"
+#include "SincResampler.h"
+#include <cmath>
+
+SincResampler::SincResampler()
+{
+	_kernels.resize((PhaseCount + 1) * MaxTapCount);
+	_pendingSamples.reserve(0x1000);
+	UpdateKernels();
+}
+
+void SincResampler::Reset()
+{
+	memset(_historyLeft, 0, sizeof(_historyLeft));
+	memset(_historyRight, 0, sizeof(_historyRight));
+	_historyPos = 0;
+	_fraction = 0.0;
+}
+
+void SincResampler::SetTapCount(uint32_t tapCount)
+{
+	//Tap count must be a multiple of 8 (see InterpolateSample)
+	tapCount = std::clamp<uint32_t>(tapCount & ~0x07, MinTapCount, MaxTapCount);
+	if(_tapCount != tapCount) {
+		_tapCount = tapCount;
+		Reset();
+		UpdateKernels();
+	}
+}
+
+void SincResampler::SetVolume(double volume)
+{
+	_volume = (int32_t)(volume * 256);
+}
+
+void SincResampler::SetSampleRates(double srcRate, double dstRate)
+{
+	_rateRatio = srcRate / dstRate;
+
+	//Cut off slightly below the nyquist frequency of the lowest of the 2 rates, to leave room for the filter's transition band
+	double cutoff = std::min(1.0, 1.0 / _rateRatio) * 0.92;
+
+	//The dynamic sample rate adjustment constantly changes the ratio by tiny amounts, only rebuild the kernels when the difference is audible
+	if(std::abs(cutoff - _cutoff) > 0.005) {
+		_cutoff = cutoff;
+		UpdateKernels();
+	}
+}
+
+uint32_t SincResampler::GetPendingCount()
+{
+	return (uint32_t)_pendingSamples.size() / 2;
+}
+
+void SincResampler::UpdateKernels()
+{
+	constexpr double pi = 3.14159265358979323846;
+	double cutoff = _cutoff > 0 ? _cutoff : 0.92;
+	int32_t halfTaps = _tapCount / 2;
+
+	for(uint32_t phase = 0; phase <= PhaseCount; phase++) {
+		double fraction = (double)phase / PhaseCount;
+		float* kernel = &_kernels[phase * _tapCount];
+
+		double sum = 0;
+		for(uint32_t i = 0; i < _tapCount; i++) {
+			//Distance between the tap and the position being interpolated (between taps halfTaps - 1 and halfTaps)
+			double x = (int32_t)i - (halfTaps - 1) - fraction;
+			double sinc = x == 0 ? 1.0 : std::sin(pi * cutoff * x) / (pi * cutoff * x);
+
+			//Blackman window over [-halfTaps, halfTaps]
+			double n = (x + halfTaps) / _tapCount;
+			double window = 0.42 - 0.5 * std::cos(2 * pi * n) + 0.08 * std::cos(4 * pi * n);
+
+			double value = sinc * std::max(0.0, window);
+			kernel[i] = (float)value;
+			sum += value;
+		}
+
+		//Normalize each phase to unity gain to avoid any DC ripple between phases
+		for(uint32_t i = 0; i < _tapCount; i++) {
+			kernel[i] = (float)(kernel[i] / sum);
+		}
+	}
+}
+
+void SincResampler::PushSample(int16_t left, int16_t right)
+{
+	_historyLeft[_historyPos] = _historyLeft[_historyPos + _tapCount] = left;
+	_historyRight[_historyPos] = _historyRight[_historyPos + _tapCount] = right;
+	_historyPos++;
+	if(_historyPos >= _tapCount) {
+		_historyPos = 0;
+	}
+}
+
+template<uint32_t tapCount>
+void SincResampler::InterpolateSample(double fraction, int16_t& left, int16_t& right)
+{
+	double pos = fraction * PhaseCount;
+	uint32_t phase = std::min((uint32_t)pos, PhaseCount - 1);
+	float phaseFraction = (float)(pos - phase);
+
+	const float* k0 = &_kernels[phase * tapCount];
+	const float* k1 = k0 + tapCount;
+	const float* histLeft = _historyLeft + _historyPos;
+	const float* histRight = _historyRight + _historyPos;
+
+	//Use 8 independent accumulators per channel - this lets the compiler vectorize the loop
+	//without needing to reorder the floating point additions
+	float accLeft[8] = {};
+	float accRight[8] = {};
+	for(uint32_t i = 0; i < tapCount; i += 8) {
+		for(uint32_t j = 0; j < 8; j++) {
+			float coeff = k0[i + j] + (k1[i + j] - k0[i + j]) * phaseFraction;
+			accLeft[j] += histLeft[i + j] * coeff;
+			accRight[j] += histRight[i + j] * coeff;
+		}
+	}
+
+	float outLeft = ((accLeft[0] + accLeft[4]) + (accLeft[1] + accLeft[5])) + ((accLeft[2] + accLeft[6]) + (accLeft[3] + accLeft[7]));
+	float outRight = ((accRight[0] + accRight[4]) + (accRight[1] + accRight[5])) + ((accRight[2] + accRight[6]) + (accRight[3] + accRight[7]));
+	left = (int16_t)std::clamp(outLeft, -32768.0f, 32767.0f);
+	right = (int16_t)std::clamp(outRight, -32768.0f, 32767.0f);
+}
+
+template<bool addMode>
+void SincResampler::WriteSample(int16_t* out, uint32_t pos, int16_t left, int16_t right)
+{
+	if(addMode) {
+		out[pos] = (int16_t)std::clamp<int32_t>(out[pos] + ((left * _volume) >> 8), INT16_MIN, INT16_MAX);
+		out[pos + 1] = (int16_t)std::clamp<int32_t>(out[pos + 1] + ((right * _volume) >> 8), INT16_MIN, INT16_MAX);
+	} else {
+		out[pos] = (int16_t)std::clamp<int32_t>((left * _volume) >> 8, INT16_MIN, INT16_MAX);
+		out[pos + 1] = (int16_t)std::clamp<int32_t>((right * _volume) >> 8, INT16_MIN, INT16_MAX);
+	}
+}
+
+template<uint32_t tapCount, bool addMode>
+uint32_t SincResampler::ProcessSamples(int16_t* in, uint32_t inSampleCount, int16_t* out, size_t maxOutSampleCount, uint32_t outPos)
+{
+	int16_t left, right;
+	for(uint32_t i = 0; i < inSampleCount * 2; i += 2) {
+		while(_fraction <= 1.0) {
+			//Generate interpolated samples until we have enough samples for the current source sample
+			InterpolateSample<tapCount>(_fraction, left, right);
+			if(maxOutSampleCount == 0 || outPos <= maxOutSampleCount - 2) {
+				WriteSample<addMode>(out, outPos, left, right);
+				outPos += 2;
+			} else {
+				_pendingSamples.push_back(left);
+				_pendingSamples.push_back(right);
+			}
+
+			_fraction += _rateRatio;
+		}
+
+		//Move to the next source sample
+		PushSample(in[i], in[i + 1]);
+		_fraction -= 1.0;
+	}
+
+	return outPos / 2;
+}
+
+template<bool addMode>
+uint32_t SincResampler::Resample(int16_t* in, uint32_t inSampleCount, int16_t* out, size_t maxOutSampleCount)
+{
+	maxOutSampleCount *= 2;
+
+	uint32_t outPos = (uint32_t)_pendingSamples.size();
+	for(uint32_t i = 0; i < outPos; i += 2) {
+		WriteSample<addMode>(out, i, _pendingSamples[i], _pendingSamples[i + 1]);
+	}
+	_pendingSamples.clear();
+
+	switch(_tapCount) {
+		case 8: return ProcessSamples<8, addMode>(in, inSampleCount, out, maxOutSampleCount, outPos);
+		case 16: return ProcessSamples<16, addMode>(in, inSampleCount, out, maxOutSampleCount, outPos);
+		case 24: return ProcessSamples<24, addMode>(in, inSampleCount, out, maxOutSampleCount, outPos);
+		default: return ProcessSamples<32, addMode>(in, inSampleCount, out, maxOutSampleCount, outPos);
+	}
+}
+
+template uint32_t SincResampler::Resample<true>(int16_t* in, uint32_t inSampleCount, int16_t* out, size_t maxOutSampleCount);
+template uint32_t SincResampler::Resample<false>(int16_t* in, uint32_t inSampleCount, int16_t* out, size_t maxOutSampleCount);
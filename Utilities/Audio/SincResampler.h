@@ -0,0 +1,54 @@
+#pragma once
+#include "pch.h"
+
+//Polyphase windowed-sinc resampler (stereo, interleaved input/output)
+//Kernels are precalculated for PhaseCount fractional positions and linearly interpolated between phases
+class SincResampler
+{
+public:
+	static constexpr uint32_t MinTapCount = 8;
+	static constexpr uint32_t MaxTapCount = 32;
+	static constexpr uint32_t PhaseCount = 256;
+
+private:
+	uint32_t _tapCount = 16;
+	int32_t _volume = 256;
+	double _rateRatio = 1.0;
+	double _fraction = 0.0;
+	double _cutoff = 0.0;
+
+	//(PhaseCount + 1) kernels of _tapCount coefficients each
+	vector<float> _kernels;
+
+	//Each sample is written twice (at pos and pos + _tapCount) so the last _tapCount samples are always contiguous
+	float _historyLeft[MaxTapCount * 2] = {};
+	float _historyRight[MaxTapCount * 2] = {};
+	uint32_t _historyPos = 0;
+
+	vector<int16_t> _pendingSamples;
+
+	void UpdateKernels();
+	__forceinline void PushSample(int16_t left, int16_t right);
+
+	template<uint32_t tapCount>
+	__forceinline void InterpolateSample(double fraction, int16_t& left, int16_t& right);
+
+	template<bool addMode>
+	__forceinline void WriteSample(int16_t* out, uint32_t pos, int16_t left, int16_t right);
+
+	template<uint32_t tapCount, bool addMode>
+	uint32_t ProcessSamples(int16_t* in, uint32_t inSampleCount, int16_t* out, size_t maxOutSampleCount, uint32_t outPos);
+
+public:
+	SincResampler();
+
+	void Reset();
+
+	void SetTapCount(uint32_t tapCount);
+	void SetVolume(double volume);
+	void SetSampleRates(double srcRate, double dstRate);
+	uint32_t GetPendingCount();
+
+	template<bool addMode>
+	uint32_t Resample(int16_t* in, uint32_t inSampleCount, int16_t* out, size_t maxOutSampleCount);
+};
@@ -60,6 +60,18 @@ public:
 		_pos += (uint16_t)str.size();
 	}
 
+	void Write(string_view str, bool preserveCase = false)
+	{
+		if(_lowerCase && !preserveCase) {
+			for(size_t i = 0; i < str.size(); i++) {
+				_buffer[_pos + i] = ::tolower(str[i]);
+			}
+		} else {
+			memcpy(_buffer + _pos, str.data(), str.size());
+		}
+		_pos += (uint16_t)str.size();
+	}
+
 	void Write(FastString &str)
 	{
 		memcpy(_buffer + _pos, str._buffer, str._pos);
@@ -0,0 +1,249 @@
+#include "pch.h"
+#include <sstream>
+#include "JsonParser.h"
+
+const JsonValue JsonValue::_nullValue;
+
+const JsonValue& JsonValue::operator[](const string& key) const
+{
+	for(const std::pair<string, JsonValue>& member : Members) {
+		if(member.first == key) {
+			return member.second;
+		}
+	}
+	return _nullValue;
+}
+
+const JsonValue& JsonValue::operator[](size_t index) const
+{
+	return index < Items.size() ? Items[index] : _nullValue;
+}
+
+bool JsonValue::HasMember(const string& key) const
+{
+	for(const std::pair<string, JsonValue>& member : Members) {
+		if(member.first == key) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool JsonParser::Parse(const string& data, JsonValue& root, string& error)
+{
+	JsonParser parser;
+	parser._pos = data.c_str();
+	parser._end = data.c_str() + data.size();
+
+	root = {};
+	bool result = parser.ParseValue(root, 0);
+	if(result) {
+		parser.SkipWhitespace();
+		if(parser._pos != parser._end) {
+			parser._error = "Unexpected data after root value";
+			result = false;
+		}
+	}
+
+	if(!result) {
+		error = parser._error + " (offset " + std::to_string(parser._pos - data.c_str()) + ")";
+	}
+	return result;
+}
+
+bool JsonParser::ParseFile(const string& filename, JsonValue& root, string& error)
+{
+	ifstream file(filename, std::ios::in | std::ios::binary);
+	if(!file) {
+		error = "Could not open file";
+		return false;
+	}
+
+	std::stringstream ss;
+	ss << file.rdbuf();
+	return Parse(ss.str(), root, error);
+}
+
+void JsonParser::SkipWhitespace()
+{
+	while(_pos < _end && (*_pos == ' ' || *_pos == '\t' || *_pos == '\r' || *_pos == '\n')) {
+		_pos++;
+	}
+}
+
+bool JsonParser::Expect(char c)
+{
+	SkipWhitespace();
+	if(_pos < _end && *_pos == c) {
+		_pos++;
+		return true;
+	}
+	_error = string("Expected '") + c + "'";
+	return false;
+}
+
+bool JsonParser::ParseLiteral(const char* literal)
+{
+	size_t len = strlen(literal);
+	if((size_t)(_end - _pos) >= len && memcmp(_pos, literal, len) == 0) {
+		_pos += len;
+		return true;
+	}
+	_error = "Invalid literal";
+	return false;
+}
+
+bool JsonParser::ParseValue(JsonValue& value, uint32_t depth)
+{
+	if(depth > 100) {
+		_error = "Maximum depth exceeded";
+		return false;
+	}
+
+	SkipWhitespace();
+	if(_pos >= _end) {
+		_error = "Unexpected end of data";
+		return false;
+	}
+
+	switch(*_pos) {
+		case '{':
+			_pos++;
+			value.Type = JsonValueType::Object;
+			SkipWhitespace();
+			if(_pos < _end && *_pos == '}') {
+				_pos++;
+				return true;
+			}
+
+			while(true) {
+				value.Members.emplace_back();
+				std::pair<string, JsonValue>& member = value.Members.back();
+				SkipWhitespace();
+				if(!ParseString(member.first) || !Expect(':') || !ParseValue(member.second, depth + 1)) {
+					return false;
+				}
+
+				SkipWhitespace();
+				if(_pos < _end && *_pos == ',') {
+					_pos++;
+				} else {
+					return Expect('}');
+				}
+			}
+
+		case '[':
+			_pos++;
+			value.Type = JsonValueType::Array;
+			SkipWhitespace();
+			if(_pos < _end && *_pos == ']') {
+				_pos++;
+				return true;
+			}
+
+			while(true) {
+				value.Items.emplace_back();
+				if(!ParseValue(value.Items.back(), depth + 1)) {
+					return false;
+				}
+
+				SkipWhitespace();
+				if(_pos < _end && *_pos == ',') {
+					_pos++;
+				} else {
+					return Expect(']');
+				}
+			}
+
+		case '"':
+			value.Type = JsonValueType::String;
+			return ParseString(value.StringValue);
+
+		case 't':
+			value.Type = JsonValueType::Bool;
+			value.BoolValue = true;
+			return ParseLiteral("true");
+
+		case 'f':
+			value.Type = JsonValueType::Bool;
+			value.BoolValue = false;
+			return ParseLiteral("false");
+
+		case 'n':
+			value.Type = JsonValueType::Null;
+			return ParseLiteral("null");
+
+		default:
+			return ParseNumber(value);
+	}
+}
+
+bool JsonParser::ParseString(string& str)
+{
+	if(_pos >= _end || *_pos != '"') {
+		_error = "Expected string";
+		return false;
+	}
+	_pos++;
+
+	while(_pos < _end) {
+		char c = *_pos++;
+		if(c == '"') {
+			return true;
+		} else if(c == '\\') {
+			if(_pos >= _end) {
+				break;
+			}
+
+			c = *_pos++;
+			switch(c) {
+				case 'b': str += '\b'; break;
+				case 'f': str += '\f'; break;
+				case 'n': str += '\n'; break;
+				case 'r': str += '\r'; break;
+				case 't': str += '\t'; break;
+				case 'u': {
+					if(_end - _pos < 4) {
+						_error = "Invalid escape sequence";
+						return false;
+					}
+					uint32_t codePoint = (uint32_t)std::strtoul(string(_pos, 4).c_str(), nullptr, 16);
+					_pos += 4;
+					if(codePoint < 0x80) {
+						str += (char)codePoint;
+					} else if(codePoint < 0x800) {
+						str += (char)(0xC0 | (codePoint >> 6));
+						str += (char)(0x80 | (codePoint & 0x3F));
+					} else {
+						str += (char)(0xE0 | (codePoint >> 12));
+						str += (char)(0x80 | ((codePoint >> 6) & 0x3F));
+						str += (char)(0x80 | (codePoint & 0x3F));
+					}
+					break;
+				}
+				default: str += c; break;
+			}
+		} else {
+			str += c;
+		}
+	}
+
+	_error = "Unterminated string";
+	return false;
+}
+
+bool JsonParser::ParseNumber(JsonValue& value)
+{
+	//The input buffer is always null-terminated (std::string)
+	char* end = nullptr;
+	double number = std::strtod(_pos, &end);
+	if(end == _pos || end > _end) {
+		_error = "Unexpected character";
+		return false;
+	}
+
+	_pos = end;
+	value.Type = JsonValueType::Number;
+	value.NumberValue = number;
+	return true;
+}
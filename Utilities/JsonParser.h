@@ -0,0 +1,57 @@
+#pragma once
+#include "pch.h"
+
+enum class JsonValueType
+{
+	Null,
+	Bool,
+	Number,
+	String,
+	Array,
+	Object
+};
+
+//Minimal DOM-style JSON reader (used to load test vectors)
+class JsonValue
+{
+private:
+	static const JsonValue _nullValue;
+
+public:
+	JsonValueType Type = JsonValueType::Null;
+	bool BoolValue = false;
+	double NumberValue = 0;
+	string StringValue;
+	vector<JsonValue> Items;
+	vector<std::pair<string, JsonValue>> Members;
+
+	bool IsNull() const { return Type == JsonValueType::Null; }
+	size_t Size() const { return Type == JsonValueType::Object ? Members.size() : Items.size(); }
+
+	int64_t GetInt() const { return (int64_t)NumberValue; }
+
+	//Returns a null value when the key doesn't exist
+	const JsonValue& operator[](const string& key) const;
+	const JsonValue& operator[](size_t index) const;
+	bool HasMember(const string& key) const;
+};
+
+class JsonParser
+{
+private:
+	const char* _pos;
+	const char* _end;
+	string _error;
+
+	void SkipWhitespace();
+	bool Expect(char c);
+	bool ParseValue(JsonValue& value, uint32_t depth);
+	bool ParseString(string& str);
+	bool ParseNumber(JsonValue& value);
+	bool ParseLiteral(const char* literal);
+
+public:
+	//Returns false (and sets error) if the data isn't valid JSON
+	static bool Parse(const string& data, JsonValue& root, string& error);
+	static bool ParseFile(const string& filename, JsonValue& root, string& error);
+};
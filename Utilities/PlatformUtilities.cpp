@@ -3,6 +3,11 @@
 
 #ifdef _WIN32
 #include <Windows.h>
+#include <psapi.h>
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#else
+#include <unistd.h>
 #endif
 
 bool PlatformUtilities::_highResTimerEnabled = false;
@@ -42,4 +47,32 @@ void PlatformUtilities::RestoreTimerResolution()
 		_highResTimerEnabled = false;
 	}
 	#endif
-}
\ No newline at end of file
+}
+
+uint64_t PlatformUtilities::GetCurrentMemoryUsage()
+{
+	//Returns the process' current resident set size, in bytes
+	#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS counters = {};
+	if(K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+		return counters.WorkingSetSize;
+	}
+	return 0;
+	#elif defined(__APPLE__)
+	mach_task_basic_info_data_t info = {};
+	mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+	if(task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info, &count) != KERN_SUCCESS) {
+		return 0;
+	}
+	return (uint64_t)info.resident_size;
+	#else
+	//2nd value in statm is the number of resident pages
+	uint64_t size = 0;
+	uint64_t residentPages = 0;
+	ifstream statm("/proc/self/statm");
+	if(!(statm >> size >> residentPages)) {
+		return 0;
+	}
+	return residentPages * (uint64_t)sysconf(_SC_PAGESIZE);
+	#endif
+}
@@ -12,4 +12,6 @@ public:
 
 	static void EnableHighResolutionTimer();
 	static void RestoreTimerResolution();
+
+	static uint64_t GetCurrentMemoryUsage();
 };
\ No newline at end of file
@@ -236,6 +236,21 @@ void Serializer::PopNamePrefix()
 	UpdatePrefix();
 }
 
+void Serializer::SetMapKeyFilter(const vector<string>& keys)
+{
+	_mapKeyFilter.clear();
+	_mapPrefixFilter.clear();
+	for(const string& key : keys) {
+		_mapKeyFilter.insert(key);
+
+		//Add every prefix of the key (e.g "snes.", "snes.cpu." for "snes.cpu.a"), including the empty root prefix
+		_mapPrefixFilter.insert("");
+		for(size_t pos = key.find('.'); pos != string::npos; pos = key.find('.', pos + 1)) {
+			_mapPrefixFilter.insert(key.substr(0, pos + 1));
+		}
+	}
+}
+
 void Serializer::UpdatePrefix()
 {
 	_prefix.clear();
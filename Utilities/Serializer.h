@@ -81,6 +81,8 @@ private:
 
 	//Used by Lua API
 	unordered_map<string, SerializeMapValue> _mapValues;
+	unordered_set<string> _mapKeyFilter;
+	unordered_set<string> _mapPrefixFilter;
 
 	uint32_t _version = 0;
 	bool _saving = false;
@@ -100,6 +102,14 @@ private:
 		return _prefix + valName;
 	}
 
+	void SerializeObject(ISerializable* obj)
+	{
+		//Skip objects that can't contain any of the keys given to SetMapKeyFilter
+		if(_mapPrefixFilter.empty() || _mapPrefixFilter.find(_prefix) != _mapPrefixFilter.end()) {
+			obj->Serialize(*this);
+		}
+	}
+
 	template<typename T>
 	void WriteValue(T value)
 	{
@@ -125,6 +135,10 @@ private:
 	template<typename T>
 	void WriteMapFormat(string& key, T& value)
 	{
+		if(!_mapKeyFilter.empty() && _mapKeyFilter.find(key) == _mapKeyFilter.end()) {
+			return;
+		}
+
 		if constexpr(std::is_same<T, bool>::value) {
 			_mapValues.try_emplace(key, SerializeMapValueFormat::Bool, (bool)value);
 		} else if constexpr(std::is_integral<T>::value) {
@@ -221,6 +235,9 @@ public:
 	SerializeFormat GetFormat() { return _format; }
 	unordered_map<string, SerializeMapValue>& GetMapValues() { return _mapValues; }
 
+	//When set (Map format only), only the values with these keys are added to the map, and objects that can't contain any of them are skipped
+	void SetMapKeyFilter(const vector<string>& keys);
+
 	template <class T> struct is_unique_ptr : std::false_type {};
 	template <class T, class D> struct is_unique_ptr<std::unique_ptr<T, D>> : std::true_type {};
 	template <class T> struct is_shared_ptr : std::false_type {};
@@ -298,7 +315,7 @@ public:
 	void Stream(ISerializable& obj, const char* name, int index)
 	{
 		PushNamePrefix(name, index);
-		obj.Serialize(*this);
+		SerializeObject(&obj);
 		PopNamePrefix();
 	}
 
@@ -306,7 +323,7 @@ public:
 	{
 		static_assert(std::is_base_of<ISerializable, T>::value, "[Serializer] Object does not implement ISerializable");
 		PushNamePrefix(name, index);
-		((ISerializable*)obj.get())->Serialize(*this);
+		SerializeObject((ISerializable*)obj.get());
 		PopNamePrefix();
 	}
 
@@ -314,7 +331,7 @@ public:
 	{
 		static_assert(std::is_base_of<ISerializable, T>::value, "[Serializer] Object does not implement ISerializable");
 		PushNamePrefix(name, index);
-		((ISerializable*)obj.get())->Serialize(*this);
+		SerializeObject((ISerializable*)obj.get());
 		PopNamePrefix();
 	}
 
@@ -322,7 +339,7 @@ public:
 	{
 		static_assert(std::is_base_of<ISerializable, T>::value, "[Serializer] Object does not implement ISerializable");
 		PushNamePrefix(name, index);
-		((ISerializable*)obj.get())->Serialize(*this);
+		SerializeObject((ISerializable*)obj.get());
 		PopNamePrefix();
 	}
 
@@ -330,7 +347,7 @@ public:
 	{
 		static_assert(std::is_base_of<ISerializable, T>::value, "[Serializer] Object does not implement ISerializable");
 		PushNamePrefix(name, index);
-		((ISerializable*)obj.get())->Serialize(*this);
+		SerializeObject((ISerializable*)obj.get());
 		PopNamePrefix();
 	}
 
@@ -0,0 +1,84 @@
+#include "pch.h"
+#include "Utilities/SharedMemory.h"
+
+#ifdef _WIN32
+	#include <Windows.h>
+#else
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
+
+SharedMemory::~SharedMemory()
+{
+	Close();
+}
+
+bool SharedMemory::Create(string name, uint32_t size)
+{
+	Close();
+
+	#ifdef _WIN32
+	HANDLE handle = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, size, name.c_str());
+	if(handle == nullptr) {
+		return false;
+	}
+
+	void* buffer = MapViewOfFile(handle, FILE_MAP_ALL_ACCESS, 0, 0, size);
+	if(buffer == nullptr) {
+		CloseHandle(handle);
+		return false;
+	}
+	_handle = handle;
+	#else
+	//POSIX shared memory object names must start with a single slash
+	if(name.empty() || name[0] != '/') {
+		name = "/" + name;
+	}
+
+	int fd = shm_open(name.c_str(), O_CREAT | O_RDWR, 0600);
+	if(fd < 0) {
+		return false;
+	}
+
+	if(ftruncate(fd, size) != 0) {
+		close(fd);
+		shm_unlink(name.c_str());
+		return false;
+	}
+
+	void* buffer = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if(buffer == MAP_FAILED) {
+		shm_unlink(name.c_str());
+		return false;
+	}
+	#endif
+
+	_name = name;
+	_buffer = (uint8_t*)buffer;
+	_size = size;
+	memset(_buffer, 0, _size);
+	return true;
+}
+
+void SharedMemory::Close()
+{
+	if(!_buffer) {
+		return;
+	}
+
+	#ifdef _WIN32
+	UnmapViewOfFile(_buffer);
+	CloseHandle((HANDLE)_handle);
+	_handle = nullptr;
+	#else
+	munmap(_buffer, _size);
+	shm_unlink(_name.c_str());
+	#endif
+
+	_buffer = nullptr;
+	_size = 0;
+	_name.clear();
+}
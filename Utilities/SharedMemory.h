@@ -0,0 +1,24 @@
+#pragma once
+#include "pch.h"
+
+//Named block of memory that can be mapped by other processes (file mapping on Windows, POSIX shm elsewhere)
+class SharedMemory
+{
+private:
+	string _name;
+	uint8_t* _buffer = nullptr;
+	uint32_t _size = 0;
+
+	#ifdef _WIN32
+	void* _handle = nullptr;
+	#endif
+
+public:
+	~SharedMemory();
+
+	bool Create(string name, uint32_t size);
+	void Close();
+
+	uint8_t* GetBuffer() { return _buffer; }
+	uint32_t GetSize() { return _size; }
+};
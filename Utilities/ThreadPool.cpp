@@ -0,0 +1,114 @@
+#include "pch.h"
+#include "ThreadPool.h"
+
+ThreadPool::ThreadPool(uint32_t threadCount)
+{
+	for(uint32_t i = 0; i < threadCount; i++) {
+		_threads.push_back(std::thread([this]() { WorkerThread(); }));
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		_stopFlag = true;
+		_taskAdded.notify_all();
+	}
+
+	for(std::thread& thread : _threads) {
+		thread.join();
+	}
+}
+
+uint32_t ThreadPool::GetDefaultThreadCount()
+{
+	uint32_t coreCount = std::thread::hardware_concurrency();
+	return coreCount > 1 ? coreCount - 1 : 0;
+}
+
+void ThreadPool::WorkerThread()
+{
+	while(true) {
+		std::function<void()> task;
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_taskAdded.wait(lock, [this] { return !_tasks.empty() || _stopFlag; });
+			if(_tasks.empty()) {
+				return;
+			}
+			task = std::move(_tasks.front());
+			_tasks.pop_front();
+		}
+
+		task();
+
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_pendingTasks--;
+			if(_pendingTasks == 0) {
+				_taskDone.notify_all();
+			}
+		}
+	}
+}
+
+void ThreadPool::Enqueue(std::function<void()> task)
+{
+	if(_threads.empty()) {
+		//No worker threads, run the task on the calling thread
+		task();
+		return;
+	}
+
+	std::unique_lock<std::mutex> lock(_mutex);
+	_tasks.push_back(std::move(task));
+	_pendingTasks++;
+	_taskAdded.notify_one();
+}
+
+void ThreadPool::WaitForAll()
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	_taskDone.wait(lock, [this] { return _pendingTasks == 0; });
+}
+
+void ThreadPool::ParallelFor(uint32_t count, std::function<void(uint32_t start, uint32_t end)> func, uint32_t minRangeSize)
+{
+	if(count == 0) {
+		return;
+	}
+
+	uint32_t rangeCount = std::min<uint32_t>(GetThreadCount() + 1, std::max<uint32_t>(count / std::max<uint32_t>(minRangeSize, 1), 1));
+	if(rangeCount <= 1) {
+		func(0, count);
+		return;
+	}
+
+	uint32_t rangeSize = (count + rangeCount - 1) / rangeCount;
+
+	std::mutex doneMutex;
+	std::condition_variable doneSignal;
+	uint32_t remaining = rangeCount - 1;
+
+	for(uint32_t i = 1; i < rangeCount; i++) {
+		uint32_t start = std::min(count, i * rangeSize);
+		uint32_t end = std::min(count, start + rangeSize);
+		Enqueue([=, &func, &doneMutex, &doneSignal, &remaining]() {
+			if(start < end) {
+				func(start, end);
+			}
+			std::unique_lock<std::mutex> lock(doneMutex);
+			remaining--;
+			if(remaining == 0) {
+				doneSignal.notify_all();
+			}
+		});
+	}
+
+	//The calling thread processes the first range itself
+	func(0, std::min(count, rangeSize));
+
+	std::unique_lock<std::mutex> lock(doneMutex);
+	doneSignal.wait(lock, [&remaining] { return remaining == 0; });
+}
\ No newline at end of file
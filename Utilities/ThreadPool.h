@@ -0,0 +1,37 @@
+#pragma once
+#include "pch.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <deque>
+
+//Fixed-size pool of worker threads used to split CPU-heavy work (encoding, searching, hashing) across cores
+class ThreadPool
+{
+private:
+	vector<std::thread> _threads;
+	std::mutex _mutex;
+	std::condition_variable _taskAdded;
+	std::condition_variable _taskDone;
+	std::deque<std::function<void()>> _tasks;
+	uint32_t _pendingTasks = 0;
+	bool _stopFlag = false;
+
+	void WorkerThread();
+
+public:
+	ThreadPool(uint32_t threadCount = ThreadPool::GetDefaultThreadCount());
+	~ThreadPool();
+
+	//One thread per available core, minus the calling thread (which also takes part in ParallelFor)
+	static uint32_t GetDefaultThreadCount();
+
+	uint32_t GetThreadCount() { return (uint32_t)_threads.size(); }
+
+	void Enqueue(std::function<void()> task);
+	void WaitForAll();
+
+	//Splits [0, count) into ranges processed in parallel by the workers and the calling thread, returns once all ranges are done
+	void ParallelFor(uint32_t count, std::function<void(uint32_t start, uint32_t end)> func, uint32_t minRangeSize = 1);
+};
\ No newline at end of file
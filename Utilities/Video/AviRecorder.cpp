@@ -1,15 +1,13 @@
 #include "pch.h"
 #include "AviRecorder.h"
 
-AviRecorder::AviRecorder(VideoCodec codec, uint32_t compressionLevel)
+AviRecorder::AviRecorder(VideoCodec codec, uint32_t compressionLevel, VideoRecordQueuePolicy queuePolicy)
 {
 	_recording = false;
-	_stopFlag = false;
-	_frameBuffer = nullptr;
-	_frameBufferLength = 0;
 	_sampleRate = 0;
 	_codec = codec;
 	_compressionLevel = compressionLevel;
+	_queuePolicy = queuePolicy;
 }
 
 AviRecorder::~AviRecorder()
@@ -17,11 +15,6 @@ AviRecorder::~AviRecorder()
 	if(_recording) {
 		StopRecording();
 	}
-
-	if(_frameBuffer) {
-		delete[] _frameBuffer;
-		_frameBuffer = nullptr;
-	}
 }
 
 bool AviRecorder::StartRecording(string filename, uint32_t width, uint32_t height, uint32_t bpp, uint32_t audioSampleRate, double fps)
@@ -32,8 +25,6 @@ bool AviRecorder::StartRecording(string filename, uint32_t width, uint32_t heigh
 		_width = width;
 		_height = height;
 		_fps = fps;
-		_frameBufferLength = height * width * bpp;
-		_frameBuffer = new uint8_t[_frameBufferLength];
 
 		_aviWriter.reset(new AviWriter());
 		if(!_aviWriter->StartWrite(filename, _codec, width, height, bpp, (uint32_t)(_fps * 1000000), audioSampleRate, _compressionLevel)) {
@@ -41,16 +32,12 @@ bool AviRecorder::StartRecording(string filename, uint32_t width, uint32_t heigh
 			return false;
 		}
 
-		_aviWriterThread = std::thread([=]() {
-			while(!_stopFlag) {
-				_waitFrame.Wait();
-				if(_stopFlag) {
-					break;
-				}
-
-				auto lock = _lock.AcquireSafe();
-				_aviWriter->AddFrame(_frameBuffer);
+		//Audio is queued along with the frames to keep both streams in sync in the output file
+		_queue.Start(height * width * bpp, _queuePolicy, [this](VideoRecorderQueue::FrameSlot& slot) {
+			if(!slot.AudioData.empty()) {
+				_aviWriter->AddSound(slot.AudioData.data(), (uint32_t)slot.AudioData.size() / 2);
 			}
+			_aviWriter->AddFrame(slot.FrameData.data());
 		});
 
 		_recording = true;
@@ -60,12 +47,16 @@ bool AviRecorder::StartRecording(string filename, uint32_t width, uint32_t heigh
 
 void AviRecorder::StopRecording()
 {
-	if(_recording) {
-		_recording = false;
+	//StopRecording can be called by the UI thread while the emulation thread is adding frames or audio
+	//(which can also stop the recording), only the first caller is allowed to stop the queue and close the file
+	if(_recording.exchange(false)) {
+		_queue.Stop();
 
-		_stopFlag = true;
-		_waitFrame.Signal();
-		_aviWriterThread.join();
+		//Write the audio received after the last frame, to avoid cutting off the end of the recording
+		vector<int16_t> audioData = _queue.TakePendingAudio();
+		if(!audioData.empty()) {
+			_aviWriter->AddSound(audioData.data(), (uint32_t)audioData.size() / 2);
+		}
 
 		_aviWriter->EndWrite();
 		_aviWriter.reset();
@@ -78,9 +69,7 @@ void AviRecorder::AddFrame(void* frameBuffer, uint32_t width, uint32_t height, d
 		if(_width != width || _height != height || _fps != fps) {
 			StopRecording();
 		} else {
-			auto lock = _lock.AcquireSafe();
-			memcpy(_frameBuffer, frameBuffer, _frameBufferLength);
-			_waitFrame.Signal();
+			_queue.AddFrame(frameBuffer);
 		}
 	}
 }
@@ -89,10 +78,9 @@ void AviRecorder::AddSound(int16_t* soundBuffer, uint32_t sampleCount, uint32_t
 {
 	if(_recording) {
 		if(_sampleRate != sampleRate) {
-			auto lock = _lock.AcquireSafe();
 			StopRecording();
 		} else {
-			_aviWriter->AddSound(soundBuffer, sampleCount);
+			_queue.AddSound(soundBuffer, sampleCount);
 		}
 	}
 }
@@ -105,4 +93,9 @@ bool AviRecorder::IsRecording()
 string AviRecorder::GetOutputFile()
 {
 	return _outputFile;
+}
+
+VideoRecorderStats AviRecorder::GetStats()
+{
+	return _queue.GetStats();
 }
\ No newline at end of file
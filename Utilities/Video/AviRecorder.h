@@ -1,26 +1,18 @@
 #pragma once
 #include "pch.h"
-#include <thread>
-#include "Utilities/AutoResetEvent.h"
-#include "Utilities/SimpleLock.h"
 #include "Utilities/Video/AviWriter.h"
 #include "Utilities/Video/IVideoRecorder.h"
+#include "Utilities/Video/VideoRecorderQueue.h"
 
 class AviRecorder final : public IVideoRecorder
 {
 private:
-	std::thread _aviWriterThread;
-	
 	unique_ptr<AviWriter> _aviWriter;
+	VideoRecorderQueue _queue;
 
 	string _outputFile;
-	SimpleLock _lock;
-	AutoResetEvent _waitFrame;
 
-	atomic<bool> _stopFlag;	
-	bool _recording;
-	uint8_t* _frameBuffer;
-	uint32_t _frameBufferLength;
+	atomic<bool> _recording;
 	uint32_t _sampleRate;
 
 	double _fps;
@@ -29,9 +21,10 @@ private:
 
 	VideoCodec _codec;
 	uint32_t _compressionLevel;
+	VideoRecordQueuePolicy _queuePolicy;
 
 public:
-	AviRecorder(VideoCodec codec, uint32_t compressionLevel);
+	AviRecorder(VideoCodec codec, uint32_t compressionLevel, VideoRecordQueuePolicy queuePolicy = VideoRecordQueuePolicy::Block);
 	virtual ~AviRecorder();
 
 	bool StartRecording(string filename, uint32_t width, uint32_t height, uint32_t bpp, uint32_t audioSampleRate, double fps) override;
@@ -42,4 +35,5 @@ public:
 
 	bool IsRecording() override;
 	string GetOutputFile() override;
+	VideoRecorderStats GetStats() override;
 };
\ No newline at end of file
@@ -2,9 +2,10 @@
 #include "GifRecorder.h"
 #include "gif.h"
 
-GifRecorder::GifRecorder()
+GifRecorder::GifRecorder(VideoRecordQueuePolicy queuePolicy)
 {
 	_gif.reset(new GifWriter());
+	_queuePolicy = queuePolicy;
 }
 
 GifRecorder::~GifRecorder()
@@ -15,25 +16,38 @@ GifRecorder::~GifRecorder()
 bool GifRecorder::StartRecording(string filename, uint32_t width, uint32_t height, uint32_t bpp, uint32_t audioSampleRate, double fps)
 {
 	_outputFile = filename;
+	_width = width;
+	_height = height;
 	_recording = GifBegin(_gif.get(), filename.c_str(), width, height, 2, 8, false);
 	_frameCounter = 0;
+
+	if(_recording) {
+		_queue.Start(width * height * bpp, _queuePolicy, [this](VideoRecorderQueue::FrameSlot& slot) {
+			GifWriteFrame(_gif.get(), slot.FrameData.data(), _width, _height, 2, 8, false);
+		});
+	}
 	return _recording;
 }
 
 void GifRecorder::StopRecording()
 {
-	if(_recording) {
+	if(_recording.exchange(false)) {
+		_queue.Stop();
 		GifEnd(_gif.get());
 	}
 }
 
 void GifRecorder::AddFrame(void* frameBuffer, uint32_t width, uint32_t height, double fps)
 {
+	if(!_recording || width != _width || height != _height) {
+		return;
+	}
+
 	_frameCounter++;
 	
 	if(fps < 55 || (_frameCounter % 6) != 0) {
 		//At 60 FPS, skip 1 of every 6 frames (max FPS for GIFs is 50fps)
-		GifWriteFrame(_gif.get(), (uint8_t*)frameBuffer, width, height, 2, 8, false);
+		_queue.AddFrame(frameBuffer);
 	}
 }
 
@@ -49,4 +63,9 @@ bool GifRecorder::IsRecording()
 string GifRecorder::GetOutputFile()
 {
 	return _outputFile;
+}
+
+VideoRecorderStats GifRecorder::GetStats()
+{
+	return _queue.GetStats();
 }
\ No newline at end of file
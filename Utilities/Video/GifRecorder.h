@@ -1,6 +1,7 @@
 #pragma once
 #include "pch.h"
 #include "Utilities/Video/IVideoRecorder.h"
+#include "Utilities/Video/VideoRecorderQueue.h"
 
 struct GifWriter;
 
@@ -8,12 +9,16 @@ class GifRecorder final : public IVideoRecorder
 {
 private:
 	std::unique_ptr<GifWriter> _gif;
-	bool _recording = false;
+	VideoRecorderQueue _queue;
+	atomic<bool> _recording = false;
 	uint32_t _frameCounter = 0;
+	uint32_t _width = 0;
+	uint32_t _height = 0;
 	string _outputFile;
+	VideoRecordQueuePolicy _queuePolicy;
 
 public:
-	GifRecorder();
+	GifRecorder(VideoRecordQueuePolicy queuePolicy = VideoRecordQueuePolicy::Block);
 	virtual ~GifRecorder();
 
 	bool StartRecording(string filename, uint32_t width, uint32_t height, uint32_t bpp, uint32_t audioSampleRate, double fps) override;
@@ -22,4 +27,5 @@ public:
 	void AddSound(int16_t* soundBuffer, uint32_t sampleCount, uint32_t sampleRate) override;
 	bool IsRecording() override;
 	string GetOutputFile() override;
+	VideoRecorderStats GetStats() override;
 };
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 #include "pch.h"
+#include "Utilities/Video/VideoRecorderQueue.h"
 
 class IVideoRecorder
 {
@@ -14,4 +15,5 @@ public:
 
 	virtual bool IsRecording() = 0;
 	virtual string GetOutputFile() = 0;
+	virtual VideoRecorderStats GetStats() = 0;
 };
\ No newline at end of file
@@ -0,0 +1,144 @@
+#include "pch.h"
+#include "Utilities/Video/VideoRecorderQueue.h"
+#include "Utilities/Timer.h"
+
+VideoRecorderQueue::~VideoRecorderQueue()
+{
+	Stop();
+}
+
+void VideoRecorderQueue::Start(uint32_t frameSize, VideoRecordQueuePolicy policy, EncodeFrameCallback encodeFrame, uint32_t queueSize)
+{
+	Stop();
+
+	_slots.clear();
+	_slots.resize(std::max<uint32_t>(queueSize, 1));
+	for(FrameSlot& slot : _slots) {
+		slot.FrameData.resize(frameSize);
+	}
+
+	_readPos = 0;
+	_writePos = 0;
+	_queuedFrames = 0;
+	_stopFlag = false;
+	_policy = policy;
+	_encodeFrame = encodeFrame;
+	_pendingAudio.clear();
+
+	_encodedFrames = 0;
+	_droppedFrames = 0;
+	_totalEncodeTime = 0;
+	_maxEncodeTime = 0;
+
+	_running = true;
+	_writerThread = std::thread([=]() { WriterThread(); });
+}
+
+void VideoRecorderQueue::Stop()
+{
+	if(!_running) {
+		return;
+	}
+
+	{
+		//Let the writer thread encode all the frames that are still in the queue before stopping
+		std::unique_lock<std::mutex> lock(_mutex);
+		_stopFlag = true;
+		_frameAdded.notify_all();
+	}
+	_writerThread.join();
+
+	std::unique_lock<std::mutex> lock(_mutex);
+	_running = false;
+}
+
+void VideoRecorderQueue::WriterThread()
+{
+	while(true) {
+		FrameSlot* slot = nullptr;
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_frameAdded.wait(lock, [this] { return _queuedFrames > 0 || _stopFlag; });
+			if(_queuedFrames == 0) {
+				//Stop requested and the queue is empty
+				break;
+			}
+			slot = &_slots[_readPos];
+		}
+
+		//The slot is owned by this thread until it is released below, encode without holding the lock
+		Timer timer;
+		_encodeFrame(*slot);
+		double elapsed = timer.GetElapsedMS();
+
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			slot->AudioData.clear();
+			_readPos = (_readPos + 1) % _slots.size();
+			_queuedFrames--;
+
+			_encodedFrames++;
+			_totalEncodeTime += elapsed;
+			_maxEncodeTime = std::max(_maxEncodeTime, elapsed);
+			_frameRemoved.notify_all();
+		}
+	}
+}
+
+bool VideoRecorderQueue::AddFrame(void* frameBuffer)
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	if(!_running || _stopFlag) {
+		return false;
+	}
+
+	if(_queuedFrames == _slots.size()) {
+		if(_policy == VideoRecordQueuePolicy::DropFrames) {
+			//Keep the pending audio, it will be written along with the next frame
+			_droppedFrames++;
+			return false;
+		}
+
+		//Wait for the writer thread to free up a buffer
+		_frameRemoved.wait(lock, [this] { return _queuedFrames < _slots.size(); });
+	}
+
+	FrameSlot& slot = _slots[_writePos];
+	memcpy(slot.FrameData.data(), frameBuffer, slot.FrameData.size());
+	slot.AudioData.swap(_pendingAudio);
+
+	_writePos = (_writePos + 1) % _slots.size();
+	_queuedFrames++;
+	_frameAdded.notify_all();
+	return true;
+}
+
+void VideoRecorderQueue::AddSound(int16_t* soundBuffer, uint32_t sampleCount)
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	if(_running) {
+		_pendingAudio.insert(_pendingAudio.end(), soundBuffer, soundBuffer + sampleCount * 2);
+	}
+}
+
+vector<int16_t> VideoRecorderQueue::TakePendingAudio()
+{
+	//Returns the audio that was received after the last queued frame
+	std::unique_lock<std::mutex> lock(_mutex);
+	vector<int16_t> audioData;
+	audioData.swap(_pendingAudio);
+	return audioData;
+}
+
+VideoRecorderStats VideoRecorderQueue::GetStats()
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	VideoRecorderStats stats = {};
+	stats.QueuedFrames = _queuedFrames;
+	stats.QueueSize = (uint32_t)_slots.size();
+	stats.EncodedFrames = _encodedFrames;
+	stats.DroppedFrames = _droppedFrames;
+	stats.AverageEncodeTime = _encodedFrames > 0 ? _totalEncodeTime / _encodedFrames : 0;
+	stats.MaxEncodeTime = _maxEncodeTime;
+	return stats;
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include "pch.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+enum class VideoRecordQueuePolicy
+{
+	//Block the emulation thread until a buffer is available (no frames are ever lost)
+	Block = 0,
+
+	//Drop the new frame when all buffers are busy (counted in VideoRecorderStats::DroppedFrames)
+	DropFrames = 1
+};
+
+struct VideoRecorderStats
+{
+	uint32_t QueuedFrames;
+	uint32_t QueueSize;
+	uint64_t EncodedFrames;
+	uint64_t DroppedFrames;
+	double AverageEncodeTime;
+	double MaxEncodeTime;
+};
+
+//Bounded ring of preallocated frame buffers, encoded in order by a dedicated writer thread
+class VideoRecorderQueue
+{
+public:
+	static constexpr uint32_t DefaultQueueSize = 8;
+
+	struct FrameSlot
+	{
+		vector<uint8_t> FrameData;
+		vector<int16_t> AudioData;
+	};
+
+	typedef std::function<void(FrameSlot& slot)> EncodeFrameCallback;
+
+private:
+	std::thread _writerThread;
+	std::mutex _mutex;
+	std::condition_variable _frameAdded;
+	std::condition_variable _frameRemoved;
+
+	vector<FrameSlot> _slots;
+	uint32_t _readPos = 0;
+	uint32_t _writePos = 0;
+	uint32_t _queuedFrames = 0;
+	bool _stopFlag = false;
+	bool _running = false;
+
+	VideoRecordQueuePolicy _policy = VideoRecordQueuePolicy::Block;
+	EncodeFrameCallback _encodeFrame;
+
+	//Audio received since the last frame was queued, attached to the next queued frame
+	vector<int16_t> _pendingAudio;
+
+	uint64_t _encodedFrames = 0;
+	uint64_t _droppedFrames = 0;
+	double _totalEncodeTime = 0;
+	double _maxEncodeTime = 0;
+
+	void WriterThread();
+
+public:
+	~VideoRecorderQueue();
+
+	void Start(uint32_t frameSize, VideoRecordQueuePolicy policy, EncodeFrameCallback encodeFrame, uint32_t queueSize = DefaultQueueSize);
+	void Stop();
+
+	bool AddFrame(void* frameBuffer);
+	void AddSound(int16_t* soundBuffer, uint32_t sampleCount);
+	vector<int16_t> TakePendingAudio();
+
+	VideoRecorderStats GetStats();
+};
@@ -28,6 +28,11 @@
 #include "miniz.h"
 #include "ZmbvCodec.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define ZMBV_SSE2
+	#include <emmintrin.h>
+#endif
+
 #define DBZV_VERSION_HIGH 0
 #define DBZV_VERSION_LOW 1
 
@@ -87,6 +92,7 @@ bool ZmbvCodec::SetupBuffers(zmbv_format_t _format, int blockwidth, int blockhei
 	if (yleft) yblocks++;
 	blockcount=yblocks*xblocks;
 	blocks=new FrameBlock[blockcount];
+	blockXorOffsets.resize(blockcount);
 
 	if (!buf1 || !buf2 || !work || !blocks) {
 		FreeBuffers();
@@ -162,6 +168,31 @@ INLINE int ZmbvCodec::CompareBlock(int vx,int vy,FrameBlock * block) {
 	int ret=0;
 	P * pold=((P*)oldframe)+block->start+(vy*pitch)+vx;
 	P * pnew=((P*)newframe)+block->start;;	
+#ifdef ZMBV_SSE2
+	if constexpr(sizeof(P) == 4) {
+		//Count the pixels whose RGB values differ, 4 pixels at a time
+		int vectorWidth = block->dx & ~3;
+		__m128i rgbMask = _mm_set1_epi32(0x00ffffff);
+		__m128i equalCount = _mm_setzero_si128();
+		for (int y=0;y<block->dy;y++) {
+			int x = 0;
+			for (;x<vectorWidth;x+=4) {
+				__m128i oldPixels = _mm_and_si128(_mm_loadu_si128((__m128i*)(pold+x)), rgbMask);
+				__m128i newPixels = _mm_and_si128(_mm_loadu_si128((__m128i*)(pnew+x)), rgbMask);
+				equalCount = _mm_sub_epi32(equalCount, _mm_cmpeq_epi32(oldPixels, newPixels));
+			}
+			for (;x<block->dx;x++) {
+				int test=0-((pold[x]-pnew[x])&0x00ffffff);
+				ret-=(test>>31);
+			}
+			pold+=pitch;
+			pnew+=pitch;
+		}
+		alignas(16) int32_t counts[4];
+		_mm_store_si128((__m128i*)counts, equalCount);
+		return ret + vectorWidth*block->dy - (counts[0] + counts[1] + counts[2] + counts[3]);
+	}
+#endif
 	for (int y=0;y<block->dy;y++) {
 		for (int x=0;x<block->dx;x++) {
 			int test=0-((pold[x]-pnew[x])&0x00ffffff);
@@ -174,13 +205,13 @@ INLINE int ZmbvCodec::CompareBlock(int vx,int vy,FrameBlock * block) {
 }
 
 template<class P>
-INLINE void ZmbvCodec::AddXorBlock(int vx,int vy,FrameBlock * block) {
+INLINE void ZmbvCodec::AddXorBlock(int vx,int vy,FrameBlock * block,unsigned char * dest) {
 	P * pold=((P*)oldframe)+block->start+(vy*pitch)+vx;
 	P * pnew=((P*)newframe)+block->start;
 	for (int y=0;y<block->dy;y++) {
 		for (int x=0;x<block->dx;x++) {
-			*((P*)&work[workUsed])=pnew[x] ^ pold[x];
-			workUsed+=sizeof(P);
+			*((P*)dest)=pnew[x] ^ pold[x];
+			dest+=sizeof(P);
 		}
 		pold+=pitch;
 		pnew+=pitch;
@@ -188,11 +219,8 @@ INLINE void ZmbvCodec::AddXorBlock(int vx,int vy,FrameBlock * block) {
 }
 
 template<class P>
-void ZmbvCodec::AddXorFrame(void) {
-	signed char * vectors=(signed char*)&work[workUsed];
-	/* Align the following xor data on 4 byte boundary*/
-	workUsed=(workUsed + blockcount*2 +3) & ~3;
-	for (int b=0;b<blockcount;b++) {
+void ZmbvCodec::FindBlockVectors(int start, int end, signed char * vectors) {
+	for (int b=start;b<end;b++) {
 		FrameBlock * block=&blocks[b];
 		int bestvx = 0;
 		int bestvy = 0;
@@ -216,11 +244,38 @@ void ZmbvCodec::AddXorFrame(void) {
 		vectors[b*2+1]=(bestvy << 1);
 		if (bestchange) {
 			vectors[b*2+0]|=1;
-			AddXorBlock<P>(bestvx, bestvy, block);
 		}
 	}
 }
 
+template<class P>
+void ZmbvCodec::AddXorFrame(void) {
+	signed char * vectors=(signed char*)&work[workUsed];
+	/* Align the following xor data on 4 byte boundary*/
+	workUsed=(workUsed + blockcount*2 +3) & ~3;
+
+	/* Motion search - each block is independent, so they are split across the worker threads */
+	threadPool->ParallelFor(blockcount, [=](uint32_t start, uint32_t end) {
+		FindBlockVectors<P>(start, end, vectors);
+	}, 16);
+
+	/* Xor data is written in block order, calculate where each block's data starts */
+	for (int b=0;b<blockcount;b++) {
+		blockXorOffsets[b] = workUsed;
+		if (vectors[b*2+0] & 1) {
+			workUsed += blocks[b].dx * blocks[b].dy * sizeof(P);
+		}
+	}
+
+	threadPool->ParallelFor(blockcount, [=](uint32_t start, uint32_t end) {
+		for (uint32_t b=start;b<end;b++) {
+			if (vectors[b*2+0] & 1) {
+				AddXorBlock<P>(vectors[b*2+0] >> 1, vectors[b*2+1] >> 1, &blocks[b], &work[blockXorOffsets[b]]);
+			}
+		}
+	}, 16);
+}
+
 bool ZmbvCodec::SetupCompress( int _width, int _height, uint32_t compressionLevel ) {
 	width = _width;
 	height = _height;
@@ -368,8 +423,9 @@ void ZmbvCodec::FreeBuffers()
 	_buf = nullptr;
 }
 
-ZmbvCodec::ZmbvCodec() 
+ZmbvCodec::ZmbvCodec(uint32_t workerThreadCount)
 {
+	threadPool.reset(new ThreadPool(workerThreadCount));
 	CreateVectorTable();
 	blocks = nullptr;
 	buf1 = nullptr;
@@ -23,6 +23,7 @@
 
 #include "BaseCodec.h"
 #include "miniz.h"
+#include "Utilities/ThreadPool.h"
 
 #ifdef _MSC_VER
 #define INLINE __forceinline
@@ -78,6 +79,10 @@ private:
 	int blockcount = 0; 
 	FrameBlock * blocks = nullptr;
 
+	//Per-block results of the motion search, used to write the xor data for all blocks in parallel
+	vector<int> blockXorOffsets;
+	unique_ptr<ThreadPool> threadPool;
+
 	int workUsed = 0, workPos = 0;
 
 	int palsize = 0;
@@ -97,9 +102,10 @@ private:
 	bool SetupBuffers(zmbv_format_t format, int blockwidth, int blockheight);
 
 	template<class P> void AddXorFrame(void);
+	template<class P> void FindBlockVectors(int start, int end, signed char* vectors);
 	template<class P> INLINE int PossibleBlock(int vx,int vy,FrameBlock * block);
 	template<class P> INLINE int CompareBlock(int vx,int vy,FrameBlock * block);
-	template<class P> INLINE void AddXorBlock(int vx,int vy,FrameBlock * block);
+	template<class P> INLINE void AddXorBlock(int vx,int vy,FrameBlock * block,unsigned char * dest);
 
 	int NeededSize(int _width, int _height, zmbv_format_t _format);
 
@@ -108,7 +114,8 @@ private:
 	int FinishCompressFrame(uint8_t** compressedData);
 
 public:
-	ZmbvCodec();
+	//workerThreadCount = 0 runs the motion search on the calling thread only
+	ZmbvCodec(uint32_t workerThreadCount = ThreadPool::GetDefaultThreadCount());
 	bool SetupCompress(int _width, int _height, uint32_t compressionLevel) override;
 	int CompressFrame(bool isKeyFrame, uint8_t *frameData, uint8_t** compressedData) override;
 	const char* GetFourCC() override;
@@ -478,37 +478,48 @@ bool Renderer::CreateHudTexture(HudRenderInfo& hud, uint32_t newWidth, uint32_t
 		return false;
 	}
 
+	hud.NeedFullUpdate = true;
 	return true;
 }
 
-void Renderer::DrawHud(HudRenderInfo& hud, uint32_t* hudBuffer, uint32_t newWidth, uint32_t newHeight)
+void Renderer::DrawHud(HudRenderInfo& hud, RenderSurfaceInfo& surface)
 {
-	if(newWidth == 0 && newHeight == 0) {
+	if(surface.Width == 0 && surface.Height == 0) {
 		return;
 	}
 
-	if(hud.Width != newWidth || hud.Height != newHeight || !hud.Texture || !hud.Shader) {
-		if(!CreateHudTexture(hud, newWidth, newHeight)) {
+	if(hud.Width != surface.Width || hud.Height != surface.Height || !hud.Texture || !hud.Shader) {
+		if(!CreateHudTexture(hud, surface.Width, surface.Height)) {
 			return;
 		}
 	}
 
-	//Copy buffer to texture
-	uint32_t rowPitch = hud.Width * sizeof(uint32_t);
-	D3D11_MAPPED_SUBRESOURCE dd;
-	HRESULT hr = _pDeviceContext->Map(hud.Texture, 0, D3D11_MAP_WRITE_DISCARD, 0, &dd);
-	if(FAILED(hr)) {
-		MessageManager::Log("DeviceContext::Map() failed - Error:" + std::to_string(hr));
+	if(surface.DrawnRect.IsEmpty()) {
+		//Nothing to display, skip the upload & draw (pending changes are kept until the HUD is displayed again)
 		return;
 	}
-	uint8_t* surfacePointer = (uint8_t*)dd.pData;
-	uint8_t* videoBuffer = (uint8_t*)hudBuffer;
-	for(uint32_t i = 0, iMax = hud.Height; i < iMax; i++) {
-		memcpy(surfacePointer, videoBuffer, rowPitch);
-		videoBuffer += rowPitch;
-		surfacePointer += dd.RowPitch;
+
+	if(hud.NeedFullUpdate || !surface.ChangedRect.IsEmpty()) {
+		//Copy buffer to texture (the whole texture must be written when using WRITE_DISCARD)
+		uint32_t rowPitch = hud.Width * sizeof(uint32_t);
+		D3D11_MAPPED_SUBRESOURCE dd;
+		HRESULT hr = _pDeviceContext->Map(hud.Texture, 0, D3D11_MAP_WRITE_DISCARD, 0, &dd);
+		if(FAILED(hr)) {
+			MessageManager::Log("DeviceContext::Map() failed - Error:" + std::to_string(hr));
+			return;
+		}
+		uint8_t* surfacePointer = (uint8_t*)dd.pData;
+		uint8_t* videoBuffer = (uint8_t*)surface.Buffer;
+		for(uint32_t i = 0, iMax = hud.Height; i < iMax; i++) {
+			memcpy(surfacePointer, videoBuffer, rowPitch);
+			videoBuffer += rowPitch;
+			surfacePointer += dd.RowPitch;
+		}
+		_pDeviceContext->Unmap(hud.Texture, 0);
+
+		hud.NeedFullUpdate = false;
+		surface.ChangedRect.Reset();
 	}
-	_pDeviceContext->Unmap(hud.Texture, 0);
 
 	RECT destRect;
 	destRect.left = _leftMargin;
@@ -547,8 +558,8 @@ void Renderer::Render(RenderSurfaceInfo& emuHud, RenderSurfaceInfo& scriptHud)
 
 	//Draw HUD
 	_spriteBatch->Begin(SpriteSortMode_Immediate, false);
-	DrawHud(_scriptHud, scriptHud.Buffer, scriptHud.Width, scriptHud.Height);
-	DrawHud(_emuHud, emuHud.Buffer, emuHud.Width, emuHud.Height);
+	DrawHud(_scriptHud, scriptHud);
+	DrawHud(_emuHud, emuHud);
 	_spriteBatch->End();
 
 	// Present the information rendered to the back buffer to the front buffer (the screen)
@@ -21,6 +21,7 @@ struct HudRenderInfo
 	ID3D11ShaderResourceView* Shader = nullptr;
 	uint32_t Width = 0;
 	uint32_t Height = 0;
+	bool NeedFullUpdate = false;
 };
 
 class Renderer final : public IRenderingDevice
@@ -79,7 +80,7 @@ private:
 	void DrawScreen();
 
 	bool CreateHudTexture(HudRenderInfo& hud, uint32_t newWidth, uint32_t newHeight);
-	void DrawHud(HudRenderInfo& hud, uint32_t* hudBuffer, uint32_t newWidth, uint32_t newHeight);
+	void DrawHud(HudRenderInfo& hud, RenderSurfaceInfo& surface);
 		
 	HRESULT CreateRenderTargetView();
 	void ReleaseRenderTargetView();